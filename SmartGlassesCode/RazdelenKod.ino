@@ -6,6 +6,7 @@
 
 // Display state tracking variables
 unsigned long lastUpdateTime = 0;
+uint8_t oldConnectionCount = 0;
 extern bool hasTemporaryMessage;
 extern unsigned long temporaryMessageStartTime;
 extern unsigned long temporaryMessageDuration;
@@ -29,6 +30,7 @@ void setup() {
 
   // Using callbacks directly from ble.cpp since they're already defined there
   pServer->setCallbacks(new ServerCallbacks());
+  BLEDevice::setCustomGattsHandler(bleGattsEventHandler);
 
   pCommandCharacteristic = pService->createCharacteristic(
                        COMMAND_CHAR_UUID,
@@ -77,6 +79,9 @@ void setup() {
 }
 
 void loop() {
+  // Carry out screen changes requested over BLE; only loop() touches the display
+  processDisplayQueue();
+
   // Check if we need to clear a temporary message
   if (hasTemporaryMessage) {
     unsigned long currentTime = millis();
@@ -84,8 +89,7 @@ void loop() {
       hasTemporaryMessage = false;
 
       // Clear the screen after the message times out but don't show time display
-      tft.fillScreen(ST7735_BLACK);
-      isShowingTime = false;
+      clearDisplay();
     }
   }
 
@@ -98,44 +102,37 @@ void loop() {
   // Handle camera capture requests
   if (deviceConnected && captureRequested) {
     captureRequested = false;
-    if (captureImage()) {
-      currentImagePos = 0;
-      sendNextImageChunk();
-    } else {
-      pStatusCharacteristic->setValue("Capture Failed");
-      pStatusCharacteristic->notify();
-      
-      // Show error message on display
-      showUrgentAlert("Camera Error", "Failed to capture image");
-    }
+    handleCaptureRequests();
   }
   
-  // Continue sending image chunks if available
-  if (deviceConnected && imageBuffer != NULL && currentImagePos < imageBufferSize) {
-    sendNextImageChunk();
-    delay(20);
+  // Interleave queued status/text and image chunks across connected centrals
+  if (serviceNotifications()) {
+    delay(20); // Required for BLE stability
   }
   
-  // Handle device disconnection
-  if (!deviceConnected && oldDeviceConnected) {
+  // Restart advertising when a slot frees up after all were taken; below the
+  // limit onConnect already keeps it running. connectionCount changes on the
+  // Bluetooth task, so read it once.
+  uint8_t count = connectionCount;
+  if (oldConnectionCount == MAX_CONNECTIONS && count < MAX_CONNECTIONS) {
     delay(500);
     pServer->startAdvertising();
     Serial.println("Restarting advertising");
+  }
+  oldConnectionCount = count;
+  
+  // Handle last device disconnection
+  if (!deviceConnected && oldDeviceConnected) {
     oldDeviceConnected = deviceConnected;
-    if (imageBuffer != NULL) {
-      free(imageBuffer);
-      imageBuffer = NULL;
-      imageBufferSize = 0;
-    }
     
-    // Show disconnection message
-    showTemporaryMessage("Disconnected", "Waiting for connection...", 3000);
+    // Show disconnection status
+    showConnectionStatus(false);
   }
   
-  // Handle new connection
+  // Handle first device connection
   if (deviceConnected && !oldDeviceConnected) {
     oldDeviceConnected = deviceConnected;
-    showTemporaryMessage("Connected", "Device connected successfully", 3000);
+    showConnectionStatus(true);
   }
   
   // Update time display periodically
@@ -148,7 +145,7 @@ void loop() {
 
     // Only update the time if we're already showing it
     if (isShowingTime) {
-      showTimeDisplay();
+      updateTimeDisplay();
     }
   }
 
@@ -1,7 +1,7 @@
 #include "ble.h"
 #include "camera.h"     // За captureRequested, sensor_t и FRAMESIZE_QQVGA
 #include "settings.h"   // За calendarSettings, contextSettings, displaySettings и startTime
-#include "display.h"    // За showMessage, showTemporaryMessage и други дисплей функции
+#include "display.h"    // За queueMessage, queueTemporaryMessage и други дисплей заявки
 #include <ArduinoJson.h>  // За DynamicJsonDocument
 
 BLECharacteristic* pCharacteristic;
@@ -12,7 +12,8 @@ BLECharacteristic* pImageCharacteristic = nullptr;
 BLECharacteristic* pStatusCharacteristic = nullptr;
 
 // Implementation of MyCallbacks::onWrite
-void MyCallbacks::onWrite(BLECharacteristic* pCharacteristic) {
+void MyCallbacks::onWrite(BLECharacteristic* pCharacteristic, esp_ble_gatts_cb_param_t* param) {
+  ConnectionState* conn = findConnection(param->write.conn_id);
   String value = pCharacteristic->getValue().c_str();
   size_t len = value.length();
 
@@ -24,17 +25,16 @@ void MyCallbacks::onWrite(BLECharacteristic* pCharacteristic) {
 
     if (cmd == 'C') {
       Serial.println("Capture image");
+      if (conn) conn->captureRequested = true;
       captureRequested = true;
     } else if (cmd == 'S') {
       Serial.println("Status request");
-      pStatusCharacteristic->setValue("Camera Ready");
-      pStatusCharacteristic->notify();
+      notifyStatus(conn, "Camera Ready");
     } else if (cmd == 'R') {
       Serial.println("Reset request");
       sensor_t* s = esp_camera_sensor_get();
       s->set_framesize(s, FRAMESIZE_QQVGA);
-      pStatusCharacteristic->setValue("Camera Reset Complete");
-      pStatusCharacteristic->notify();
+      notifyStatus(conn, "Camera Reset Complete");
     }
   } else if (len > 1) {
     // Handle JSON-formatted messages
@@ -53,7 +53,7 @@ void MyCallbacks::onWrite(BLECharacteristic* pCharacteristic) {
         calendarSettings.meetingReminders = doc["settings"]["meetingReminders"];
         calendarSettings.dailyAgenda = doc["settings"]["dailyAgenda"];
         calendarSettings.locationBasedReminders = doc["settings"]["locationBasedReminders"];
-        showMessage("Settings Updated", "Calendar notification settings applied successfully.");
+        queueMessage("Settings Updated", "Calendar notification settings applied successfully.");
         Serial.println("Calendar settings updated:");
         Serial.println(calendarSettings.meetingReminders ? "Meeting Reminders: ON" : "Meeting Reminders: OFF");
         Serial.println(calendarSettings.dailyAgenda ? "Daily Agenda: ON" : "Daily Agenda: OFF");
@@ -62,23 +62,25 @@ void MyCallbacks::onWrite(BLECharacteristic* pCharacteristic) {
         contextSettings.locationBasedMessages = doc["settings"]["locationBasedMessages"];
         contextSettings.timeBasedMessages = doc["settings"]["timeBasedMessages"];
         contextSettings.activityBasedAlerts = doc["settings"]["activityBasedAlerts"];
-        showMessage("Settings Updated", "Context-aware messaging settings applied successfully.");
+        queueMessage("Settings Updated", "Context-aware messaging settings applied successfully.");
         Serial.println("Context settings updated:");
         Serial.println(contextSettings.locationBasedMessages ? "Location Messages: ON" : "Location Messages: OFF");
         Serial.println(contextSettings.timeBasedMessages ? "Time Messages: ON" : "Time Messages: OFF");
         Serial.println(contextSettings.activityBasedAlerts ? "Activity Alerts: ON" : "Activity Alerts: OFF");
       } else if (msgType == "display_settings") {
-        displaySettings.titleSize = doc["settings"]["titleSize"].as<String>();
-        displaySettings.messageSize = doc["settings"]["messageSize"].as<String>();
+        // The size strings are applied in loop(), which re-lays out the screens
+        String titleSize = doc["settings"]["titleSize"].as<String>();
+        String messageSize = doc["settings"]["messageSize"].as<String>();
         if (doc["settings"].containsKey("messageTimeout")) {
           displaySettings.messageTimeout = doc["settings"]["messageTimeout"];
           Serial.print("Message timeout set to: ");
           Serial.println(displaySettings.messageTimeout);
         }
-        showMessage("Display Settings", "Text size settings updated.\nTitle: " + displaySettings.titleSize + "\nMessage: " + displaySettings.messageSize);
+        queueDisplaySettings(titleSize, messageSize);
+        queueMessage("Display Settings", "Text size settings updated.\nTitle: " + titleSize + "\nMessage: " + messageSize);
         Serial.println("Display settings updated:");
-        Serial.println("Title Size: " + displaySettings.titleSize);
-        Serial.println("Message Size: " + displaySettings.messageSize);
+        Serial.println("Title Size: " + titleSize);
+        Serial.println("Message Size: " + messageSize);
       } else if (msgType == "calendar_event") {
         String eventTitle = doc["title"];
         String eventTime = doc["time"];
@@ -88,56 +90,125 @@ void MyCallbacks::onWrite(BLECharacteristic* pCharacteristic) {
         if (location.length() > 0) {
           message += "\nLocation: " + location;
         }
-        showMessage("Upcoming Meeting", message);
+        queueMessage("Upcoming Meeting", message);
       } else if (msgType == "location_message") {
         String location = doc["location"];
         String message = doc["message"];
-        showMessage("At " + location, message);
+        queueMessage("At " + location, message);
       } else if (msgType == "set_time") {
         if (doc.containsKey("hour") && doc.containsKey("minute")) {
           currentHour = doc["hour"];
           currentMinute = doc["minute"];
           startTime = millis() - ((currentHour * 60L + currentMinute) * 60L * 1000L);
-          showMessage("Time Updated", "Current time: " + getCurrentTimeString());
+          queueMessage("Time Updated", "Current time: " + getCurrentTimeString());
         }
       } else if (msgType == "daily_agenda") {
         String agendaMessage = doc["message"];
-        showMessage("Today's Agenda", agendaMessage);
+        queueMessage("Today's Agenda", agendaMessage);
       } else if (msgType == "temporary_message") {
         String title = doc["title"];
         String message = doc["message"];
         unsigned long duration = doc["duration"];
-        showTemporaryMessage(title, message, duration);
+        queueTemporaryMessage(title, message, duration);
         Serial.print("Showing temporary message for ");
         Serial.print(duration);
         Serial.println(" ms");
       } else if (msgType == "urgent_alert") {
         String title = doc["title"];
         String message = doc["message"];
-        showUrgentAlert(title, message);
+        queueUrgentAlert(title, message);
         Serial.println("Showing urgent alert");
       } else if (msgType == "show_time") {
-        showTimeDisplay();
+        queueTimeDisplay();
         Serial.println("Showing time display");
       }
     } else {
-      showMessage("Message", value);
+      queueMessage("Message", value);
     }
   }
 }
 
 // Implementation of ServerCallbacks methods
-void ServerCallbacks::onConnect(BLEServer* pServer) {
+void ServerCallbacks::onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+  if (!addConnection(param->connect.conn_id)) {
+    Serial.println("Connection limit reached, rejecting device");
+    pServer->disconnect(param->connect.conn_id);
+    return;
+  }
   deviceConnected = true;
-  Serial.println("Device connected");
+  Serial.printf("Device connected (%d/%d)\n", connectionCount, MAX_CONNECTIONS);
+
+  // Advertising stops on every connection, keep it going while slots are free
+  if (connectionCount < MAX_CONNECTIONS) {
+    pServer->startAdvertising();
+  }
+}
+
+void ServerCallbacks::onDisconnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+  removeConnection(param->disconnect.conn_id);  // Also frees its in-flight image
+  deviceConnected = connectionCount > 0;
+  Serial.printf("Device disconnected (%d/%d)\n", connectionCount, MAX_CONNECTIONS);
+}
+
+void ServerCallbacks::onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+  setConnectionMtu(param->mtu.conn_id, param->mtu.mtu);
+  Serial.printf("MTU for connection %d set to %d\n", param->mtu.conn_id, param->mtu.mtu);
 }
 
-void ServerCallbacks::onDisconnect(BLEServer* pServer) {
-  deviceConnected = false;
-  Serial.println("Device disconnected");
-  if (imageBuffer != NULL) {
-    free(imageBuffer);
-    imageBuffer = NULL;
-    imageBufferSize = 0;
+// Capture a frame for every central that asked for one and hand it to that
+// connection's transfer; the notify scheduler then streams it out
+void handleCaptureRequests() {
+  for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+    ConnectionState* conn = &connections[i];
+    if (!conn->active || !conn->captureRequested) continue;
+    conn->captureRequested = false;
+
+    if (captureImage()) {
+      beginImageTransfer(conn, imageBuffer, imageBufferSize);
+      imageBuffer = NULL;  // Now owned by the connection
+      imageBufferSize = 0;
+    } else {
+      notifyStatus(conn, "Capture Failed");
+
+      // Show error message on display
+      showUrgentAlert("Camera Error", "Failed to capture image");
+    }
   }
-}
\ No newline at end of file
+}
+
+// Queue a status reply for one central, keeping the readable value current as notify() used to
+void notifyStatus(ConnectionState* conn, const String& value) {
+  pStatusCharacteristic->setValue(value.c_str());
+  queueNotify(conn, CHANNEL_STATUS, value);
+}
+
+static BLECharacteristic* characteristicFor(NotifyChannel channel) {
+  if (channel == CHANNEL_COMMAND) return pCommandCharacteristic;
+  if (channel == CHANNEL_IMAGE) return pImageCharacteristic;
+  return pStatusCharacteristic;
+}
+
+// Scheduler transport: notify a single connection instead of every peer
+bool transportNotify(uint16_t connId, NotifyChannel channel, const uint8_t* data, size_t len) {
+  return esp_ble_gatts_send_indicate(pServer->getGattsIf(), connId, characteristicFor(channel)->getHandle(),
+                                     len, (uint8_t*)data, false) == ESP_OK;
+}
+
+static uint16_t cccdHandle(NotifyChannel channel) {
+  BLEDescriptor* cccd = characteristicFor(channel)->getDescriptorByUUID(BLEUUID((uint16_t)0x2902));
+  return cccd ? cccd->getHandle() : 0;
+}
+
+void bleGattsEventHandler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t* param) {
+  if (event == ESP_GATTS_WRITE_EVT && param->write.len == 2) {
+    // The shared BLE2902 only remembers the last writer, so track CCCDs per connection
+    bool enabled = (param->write.value[0] & 0x03) != 0;  // notify or indicate bit
+    for (uint8_t channel = 0; channel < CHANNEL_COUNT; channel++) {
+      if (param->write.handle == cccdHandle((NotifyChannel)channel)) {
+        setSubscription(param->write.conn_id, (NotifyChannel)channel, enabled);
+      }
+    }
+  } else if (event == ESP_GATTS_CONGEST_EVT) {
+    setCongested(param->congest.conn_id, param->congest.congested);
+  }
+}
@@ -7,6 +7,7 @@
 #include <BLE2902.h>
 #include <BLECharacteristic.h>
 #include <Arduino.h>
+#include "connections.h"
 
 #define SERVICE_UUID "4fafc201-1fb5-459e-8fcc-c5c9c331914b"
 #define COMMAND_CHAR_UUID "beb5483e-36e1-4688-b7f5-ea07361b26a8"
@@ -15,12 +16,13 @@
 
 // Full class definitions instead of forward declarations
 class MyCallbacks : public BLECharacteristicCallbacks {
-  void onWrite(BLECharacteristic* pCharacteristic) override;
+  void onWrite(BLECharacteristic* pCharacteristic, esp_ble_gatts_cb_param_t* param) override;
 };
 
 class ServerCallbacks : public BLEServerCallbacks {
-  void onConnect(BLEServer* pServer) override;
-  void onDisconnect(BLEServer* pServer) override;
+  void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override;
+  void onDisconnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override;
+  void onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override;
 };
 
 extern BLEServer* pServer;
@@ -34,6 +36,11 @@ extern bool oldDeviceConnected;
 extern bool captureRequested;
 extern uint8_t* imageBuffer;
 extern size_t imageBufferSize;
-extern size_t currentImagePos;
+
+void handleCaptureRequests();
+void notifyStatus(ConnectionState* conn, const String& value);
+
+// Registered with BLEDevice::setCustomGattsHandler for CCCD writes and congestion
+void bleGattsEventHandler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t* param);
 
 #endif
\ No newline at end of file
@@ -1,5 +1,4 @@
 #include "camera.h" 
-#include "ble.h"      
         
 #include <stdint.h>   // За uint8_t
 #include <stddef.h>   // За size_t
@@ -8,8 +7,6 @@
 
 uint8_t* imageBuffer = NULL;
 size_t imageBufferSize = 0;
-size_t currentImagePos = 0;
-const size_t chunkSize = 200;
 
 void setupCamera() {
   camera_config_t config;
@@ -101,15 +98,4 @@ bool captureImage() {
   Serial.printf("Image captured. Size: %d bytes\n", fb->len);
   esp_camera_fb_return(fb);
   return true;
-}
-
-void sendNextImageChunk() {
-  if (!imageBuffer || currentImagePos >= imageBufferSize) return;
-
-  size_t chunk = my_min(chunkSize, imageBufferSize - currentImagePos);
-  pImageCharacteristic->setValue(&imageBuffer[currentImagePos], chunk);
-  pImageCharacteristic->notify();
-  currentImagePos += chunk;
-  
-  delay(20); // Required for BLE stability
 }
\ No newline at end of file
@@ -33,12 +33,9 @@
 
 extern uint8_t* imageBuffer;
 extern size_t imageBufferSize;
-extern size_t currentImagePos;
-extern const size_t chunkSize;
 
 void setupCamera();
 bool captureImage();
-void sendNextImageChunk();
 
 
 
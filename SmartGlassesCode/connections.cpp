@@ -0,0 +1,207 @@
+#include "connections.h"
+
+#ifndef CUSTOM_MIN_DEFINED
+#define CUSTOM_MIN_DEFINED
+  #define my_min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+#define NOTIFY_CHUNK_MAX 512  // Largest ATT value a notification can carry
+
+ConnectionState connections[MAX_CONNECTIONS];
+uint8_t connectionCount = 0;
+const size_t chunkSize = 200;  // Largest image notification, further limited by each connection's MTU
+
+// Slots and queues are filled from BLE callbacks on the Bluetooth task and
+// drained from loop(), so every access goes through this lock
+static portMUX_TYPE connectionsMux = portMUX_INITIALIZER_UNLOCKED;
+
+// First slot served in the next scheduling round, rotated for fairness
+static uint8_t nextSlot = 0;
+
+static uint8_t chunkData[NOTIFY_CHUNK_MAX];
+
+ConnectionState* findConnection(uint16_t connId) {
+  for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+    if (connections[i].active && connections[i].connId == connId) {
+      return &connections[i];
+    }
+  }
+  return nullptr;
+}
+
+ConnectionState* addConnection(uint16_t connId) {
+  ConnectionState* conn = nullptr;
+  portENTER_CRITICAL(&connectionsMux);
+  for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+    if (!connections[i].active) {
+      conn = &connections[i];
+      memset(conn, 0, sizeof(ConnectionState));
+      conn->active = true;
+      conn->connId = connId;
+      conn->mtu = DEFAULT_ATT_MTU;
+      connectionCount++;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&connectionsMux);
+  return conn;
+}
+
+void removeConnection(uint16_t connId) {
+  uint8_t* orphanedImage = NULL;
+  portENTER_CRITICAL(&connectionsMux);
+  ConnectionState* conn = findConnection(connId);
+  if (conn) {
+    orphanedImage = conn->imageBuffer;
+    conn->imageBuffer = NULL;
+    conn->active = false;
+    connectionCount--;
+  }
+  portEXIT_CRITICAL(&connectionsMux);
+  free(orphanedImage);
+}
+
+void setConnectionMtu(uint16_t connId, uint16_t mtu) {
+  portENTER_CRITICAL(&connectionsMux);
+  ConnectionState* conn = findConnection(connId);
+  if (conn) conn->mtu = mtu;
+  portEXIT_CRITICAL(&connectionsMux);
+}
+
+void setSubscription(uint16_t connId, NotifyChannel channel, bool enabled) {
+  portENTER_CRITICAL(&connectionsMux);
+  ConnectionState* conn = findConnection(connId);
+  if (conn) conn->subscribed[channel] = enabled;
+  portEXIT_CRITICAL(&connectionsMux);
+}
+
+void setCongested(uint16_t connId, bool congested) {
+  portENTER_CRITICAL(&connectionsMux);
+  ConnectionState* conn = findConnection(connId);
+  if (conn) conn->congested = congested;
+  portEXIT_CRITICAL(&connectionsMux);
+}
+
+bool queueNotify(ConnectionState* conn, NotifyChannel channel, const String& value) {
+  if (!conn) return false;
+
+  bool queued = false;
+  portENTER_CRITICAL(&connectionsMux);
+  if (conn->active && conn->subscribed[channel] && conn->queueCount < NOTIFY_QUEUE_DEPTH) {
+    // A notification carries at most MTU - 3 bytes; the stack would truncate the rest
+    size_t len = my_min(value.length(), (size_t)NOTIFY_MAX_LEN);
+    len = my_min(len, (size_t)(conn->mtu - 3));
+    PendingNotify& slot = conn->queue[(conn->queueHead + conn->queueCount) % NOTIFY_QUEUE_DEPTH];
+    slot.channel = channel;
+    slot.length = len;
+    memcpy(slot.value, value.c_str(), len);
+    conn->queueCount++;
+    queued = true;
+  }
+  portEXIT_CRITICAL(&connectionsMux);
+  return queued;
+}
+
+// Takes ownership of buffer; it is freed once sent or when the central disconnects.
+// Sending starts once the central subscribes, which may be after it asked for the capture;
+// an image nobody subscribes to within IMAGE_SUBSCRIBE_TIMEOUT is dropped.
+void beginImageTransfer(ConnectionState* conn, uint8_t* buffer, size_t size) {
+  uint8_t* rejected = buffer;
+  portENTER_CRITICAL(&connectionsMux);
+  if (conn->active) {
+    rejected = conn->imageBuffer;  // Drop any unfinished previous image
+    conn->imageBuffer = buffer;
+    conn->imageBufferSize = size;
+    conn->imagePos = 0;
+    conn->imageQueuedAt = millis();
+  }
+  portEXIT_CRITICAL(&connectionsMux);
+  free(rejected);
+}
+
+// Send every queued text/status message of one connection.
+// Returns true if anything was sent.
+static bool drainQueue(ConnectionState& conn) {
+  bool sent = false;
+  while (true) {
+    PendingNotify pending;
+    uint16_t connId;
+    bool ready = false;
+    portENTER_CRITICAL(&connectionsMux);
+    if (conn.active && !conn.congested && conn.queueCount > 0) {
+      pending = conn.queue[conn.queueHead];
+      connId = conn.connId;
+      ready = true;
+    }
+    portEXIT_CRITICAL(&connectionsMux);
+    if (!ready || !transportNotify(connId, pending.channel, pending.value, pending.length)) return sent;
+    sent = true;
+
+    portENTER_CRITICAL(&connectionsMux);
+    if (conn.active && conn.connId == connId && conn.queueCount > 0) {
+      conn.queueHead = (conn.queueHead + 1) % NOTIFY_QUEUE_DEPTH;
+      conn.queueCount--;
+    }
+    portEXIT_CRITICAL(&connectionsMux);
+  }
+}
+
+// Free an image whose central never subscribed to the image characteristic
+static void expireImage(ConnectionState& conn) {
+  uint8_t* expired = NULL;
+  portENTER_CRITICAL(&connectionsMux);
+  if (conn.active && !conn.subscribed[CHANNEL_IMAGE] && conn.imageBuffer != NULL &&
+      millis() - conn.imageQueuedAt >= IMAGE_SUBSCRIBE_TIMEOUT) {
+    expired = conn.imageBuffer;
+    conn.imageBuffer = NULL;
+  }
+  portEXIT_CRITICAL(&connectionsMux);
+  free(expired);
+}
+
+// Send the next image chunk of one connection, sized to its negotiated MTU.
+// Returns true if a chunk was sent.
+static bool sendImageChunk(ConnectionState& conn) {
+  size_t chunk = 0;
+  uint16_t connId;
+  portENTER_CRITICAL(&connectionsMux);
+  if (conn.active && !conn.congested && conn.subscribed[CHANNEL_IMAGE] && conn.imageBuffer != NULL) {
+    chunk = my_min(chunkSize, (size_t)(conn.mtu - 3));
+    chunk = my_min(chunk, conn.imageBufferSize - conn.imagePos);
+    memcpy(chunkData, conn.imageBuffer + conn.imagePos, chunk);
+    connId = conn.connId;
+  }
+  portEXIT_CRITICAL(&connectionsMux);
+  if (chunk == 0 || !transportNotify(connId, CHANNEL_IMAGE, chunkData, chunk)) return false;
+
+  uint8_t* finished = NULL;
+  portENTER_CRITICAL(&connectionsMux);
+  if (conn.active && conn.connId == connId && conn.imageBuffer != NULL) {
+    conn.imagePos += chunk;
+    if (conn.imagePos >= conn.imageBufferSize) {
+      finished = conn.imageBuffer;
+      conn.imageBuffer = NULL;
+    }
+  }
+  portEXIT_CRITICAL(&connectionsMux);
+  free(finished);
+  return true;
+}
+
+// One scheduling round. Text and status are a few bytes each, so they go out
+// for every central before any image data; then each central with a transfer
+// gets one chunk, so a large image to one client cannot starve the others.
+// Returns true if anything went to the stack this round.
+bool serviceNotifications() {
+  bool sent = false;
+  for (uint8_t n = 0; n < MAX_CONNECTIONS; n++) {
+    sent |= drainQueue(connections[(nextSlot + n) % MAX_CONNECTIONS]);
+  }
+  for (uint8_t n = 0; n < MAX_CONNECTIONS; n++) {
+    ConnectionState& conn = connections[(nextSlot + n) % MAX_CONNECTIONS];
+    expireImage(conn);
+    sent |= sendImageChunk(conn);
+  }
+  nextSlot = (nextSlot + 1) % MAX_CONNECTIONS;
+  return sent;
+}
@@ -0,0 +1,70 @@
+#ifndef CONNECTIONS_H
+#define CONNECTIONS_H
+
+#include <Arduino.h>
+
+#define MAX_CONNECTIONS 3      // Simultaneous centrals (Bluedroid allows up to 4 ACL links by default)
+#define DEFAULT_ATT_MTU 23     // MTU until the central negotiates a larger one
+#define NOTIFY_QUEUE_DEPTH 4   // Pending text/status notifications per connection
+#define NOTIFY_MAX_LEN 64      // Longest queued text/status payload
+#define IMAGE_SUBSCRIBE_TIMEOUT 5000  // ms a captured image waits for the central to subscribe
+
+// Characteristics the scheduler sends notifications on
+enum NotifyChannel : uint8_t {
+  CHANNEL_COMMAND,
+  CHANNEL_IMAGE,
+  CHANNEL_STATUS,
+  CHANNEL_COUNT
+};
+
+// Text/status notification waiting to go out to one connection
+struct PendingNotify {
+  NotifyChannel channel;
+  uint8_t length;
+  uint8_t value[NOTIFY_MAX_LEN];
+};
+
+// Per-central state, indexed by the Bluedroid connection id
+struct ConnectionState {
+  bool active;
+  uint16_t connId;
+  uint16_t mtu;
+  bool congested;            // Stack reported its TX queue full for this link
+
+  // CCCD subscriptions, tracked per connection rather than in the shared BLE2902
+  bool subscribed[CHANNEL_COUNT];
+
+  // In-flight image transfer, owned by this connection
+  bool captureRequested;
+  uint8_t* imageBuffer;
+  size_t imageBufferSize;
+  size_t imagePos;
+  unsigned long imageQueuedAt;
+
+  PendingNotify queue[NOTIFY_QUEUE_DEPTH];
+  uint8_t queueHead;
+  uint8_t queueCount;
+};
+
+extern ConnectionState connections[MAX_CONNECTIONS];
+extern uint8_t connectionCount;
+extern const size_t chunkSize;
+
+ConnectionState* addConnection(uint16_t connId);
+void removeConnection(uint16_t connId);
+ConnectionState* findConnection(uint16_t connId);
+void setConnectionMtu(uint16_t connId, uint16_t mtu);
+void setSubscription(uint16_t connId, NotifyChannel channel, bool enabled);
+void setCongested(uint16_t connId, bool congested);
+
+bool queueNotify(ConnectionState* conn, NotifyChannel channel, const String& value);
+void beginImageTransfer(ConnectionState* conn, uint8_t* buffer, size_t size);
+
+bool serviceNotifications();
+
+// Hands one notification to the BLE stack; implemented over Bluedroid in
+// ble.cpp, so the scheduler itself has no BLE dependency. Returns false if
+// the stack did not accept the packet.
+bool transportNotify(uint16_t connId, NotifyChannel channel, const uint8_t* data, size_t len);
+
+#endif
@@ -8,10 +8,133 @@ bool isShowingTime = false;
 unsigned long temporaryMessageStartTime = 0;
 unsigned long temporaryMessageDuration = 0;
 
+// Bluetooth rune shown next to the connection status title
+const uint8_t bluetoothIcon[] = { 0x10, 0x18, 0x54, 0x38, 0x10, 0x38, 0x54, 0x18, 0x10 };
+#define BLUETOOTH_ICON_WIDTH 8
+#define BLUETOOTH_ICON_HEIGHT 9
+
+// Retained screens - only widgets that changed are repainted on update
+LabelWidget clockTitle(2, ST7735_WHITE, ST7735_BLACK);
+ClockWidget clockDigits(2, ST7735_WHITE, ST7735_BLACK);
+Widget* const clockWidgets[] = { &clockTitle, &clockDigits };
+Screen clockScreen(clockWidgets, 2);
+
+IconWidget statusIcon(bluetoothIcon, ST7735_BLUE, ST7735_BLACK);
+LabelWidget statusTitle(1, ST7735_CYAN, ST7735_BLACK);
+DividerWidget statusDivider(ST7735_CYAN, ST7735_BLACK);
+LabelWidget statusMessageLines[STATUS_MESSAGE_LINES] = {
+  LabelWidget(1, ST7735_WHITE, ST7735_BLACK),
+  LabelWidget(1, ST7735_WHITE, ST7735_BLACK)
+};
+Widget* const statusWidgets[] = {
+  &statusIcon, &statusTitle, &statusDivider, &statusMessageLines[0], &statusMessageLines[1]
+};
+Screen statusScreen(statusWidgets, 5);
+
+BorderWidget alertBorder(5, ST7735_RED, ST7735_BLACK);
+
+// Screen currently on the display, nullptr while showing immediate-mode content
+Screen* activeScreen = nullptr;
+
+enum DisplayRequestType : uint8_t {
+  REQUEST_MESSAGE,            // showMessage
+  REQUEST_TEMPORARY_MESSAGE,  // showTemporaryMessage with its own duration
+  REQUEST_URGENT_ALERT,       // showUrgentAlert
+  REQUEST_TIME_DISPLAY,       // showTimeDisplay
+  REQUEST_DISPLAY_SETTINGS    // title = title size, text = message size
+};
+
+// Fixed-size copy of a screen change, so nothing heap-owned crosses tasks
+struct DisplayRequest {
+  DisplayRequestType type;
+  char title[DISPLAY_QUEUE_TITLE_LEN];
+  char text[DISPLAY_QUEUE_TEXT_LEN];
+  unsigned long duration;
+};
+
+// Filled from BLE callbacks on the Bluetooth task and drained from loop()
+static portMUX_TYPE displayQueueMux = portMUX_INITIALIZER_UNLOCKED;
+static DisplayRequest displayQueue[DISPLAY_QUEUE_DEPTH];
+static uint8_t displayQueueHead = 0;
+static uint8_t displayQueueCount = 0;
+
+// Lay out the status screen like showTemporaryMessage, using the title and
+// message text sizes from the display settings
+void layoutStatusScreen() {
+  const FontAtlas& titleFont = fontForTextSize(getTitleTextSize());
+  const FontAtlas& messageFont = fontForTextSize(getMessageTextSize());
+
+  int titleX = BLUETOOTH_ICON_WIDTH + 4;
+  int iconY = TITLE_TOP_MARGIN + (titleFont.height - BLUETOOTH_ICON_HEIGHT) / 2;
+  statusIcon.setBounds(0, iconY, BLUETOOTH_ICON_WIDTH, BLUETOOTH_ICON_HEIGHT);
+  statusTitle.setTextSize(getTitleTextSize());
+  statusTitle.setBounds(titleX, TITLE_TOP_MARGIN, tft.width() - titleX, titleFont.height);
+
+  int lineY = TITLE_TOP_MARGIN + titleFont.height + TITLE_LINE_SPACING;
+  statusDivider.setBounds(0, lineY, tft.width(), 1);
+
+  int messageY = lineY + LINE_MESSAGE_SPACING;
+  for (int i = 0; i < STATUS_MESSAGE_LINES; i++) {
+    statusMessageLines[i].setTextSize(getMessageTextSize());
+    statusMessageLines[i].setBounds(0, messageY + i * messageFont.height, tft.width(), messageFont.height);
+  }
+}
+
+// Position widgets once the display rotation (and so its size) is known
+void layoutScreens() {
+  const FontAtlas& large = fontForTextSize(2);
+
+  clockTitle.setBounds(0, TITLE_TOP_MARGIN, tft.width(), large.height);
+  clockTitle.setText("Current time:");
+  clockDigits.setBounds(30, TITLE_TOP_MARGIN + 30, tft.width() - 30, large.height);
+
+  layoutStatusScreen();
+
+  alertBorder.setBounds(0, 0, tft.width(), tft.height());
+}
+
+// Re-layout after the title/message text sizes change. Widgets may have moved,
+// so the status screen is cleared and repainted in full the next time it shows.
+void applyDisplaySettings() {
+  layoutStatusScreen();
+  if (activeScreen == &statusScreen) {
+    activeScreen = nullptr;
+  }
+}
+
+// Word-wrap the status message over the message lines
+void setStatusMessage(const String& message) {
+  unsigned int cells = tft.width() / fontForTextSize(getMessageTextSize()).advance;
+  unsigned int start = 0;
+  for (int i = 0; i < STATUS_MESSAGE_LINES; i++) {
+    while (start < message.length() && message.charAt(start) == ' ') start++;
+
+    unsigned int end = message.length();
+    if (end - start > cells) {
+      // Break at the last space that fits, or hard break if there is none
+      end = start + cells;
+      unsigned int space = end;
+      while (space > start && message.charAt(space) != ' ') space--;
+      if (space > start) end = space;
+    }
+    statusMessageLines[i].setText(message.substring(start, end));
+    start = end;
+  }
+}
+
+// Switch to a retained screen, clearing any immediate-mode content first
+void activateScreen(Screen* screen) {
+  if (activeScreen == screen) return;
+  tft.fillScreen(ST7735_BLACK);
+  screen->invalidate();
+  activeScreen = screen;
+}
+
 void initDisplay(){
   tft.initR(INITR_BLACKTAB);  // ST7735S Initialization
   tft.fillScreen(ST7735_BLACK);
   tft.setRotation(1);  // Adjust orientation if needed
+  layoutScreens();
 
   displaySettings.titleSize = "medium";
   displaySettings.messageSize = "medium";
@@ -37,85 +160,67 @@ void showMessage(String title, String message) {
   showTemporaryMessage(title, message, displaySettings.messageTimeout);
 }
 
-// Show a temporary message with automatic timeout
-void showTemporaryMessage(String title, String message, unsigned long duration) {
+// Word-wrap text over at most maxLines lines starting at y, breaking at '\n'
+// and at the last space that fits. If the text does not fit, the last line
+// ends in "..." so the cut is visible. The area must already be cleared to
+// black, only the glyph ink is sent. Returns the number of lines drawn.
+int drawWrappedText(int y, const String& text, const FontAtlas& font, uint16_t color, int maxLines) {
+  unsigned int cells = tft.width() / font.advance;
+  unsigned int start = 0;
+  int lines = 0;
+
+  while (start < text.length() && lines < maxLines) {
+    // Take everything up to the next newline or as much as fits on the line
+    unsigned int end = start;
+    while (end < text.length() && end - start < cells && text.charAt(end) != '\n') end++;
+
+    unsigned int next = end;
+    if (end < text.length() && text.charAt(end) == '\n') {
+      next = end + 1;
+    } else if (end < text.length()) {
+      // Break at the last space that fits, or hard break if there is none
+      unsigned int space = end;
+      while (space > start && text.charAt(space) != ' ') space--;
+      if (space > start) {
+        end = space;
+        next = space + 1;
+      }
+    }
+
+    String line = text.substring(start, end);
+    lines++;
+    if (lines == maxLines && next < text.length()) {
+      line = line.substring(0, my_min(line.length(), cells - 3)) + "...";
+    }
+    drawText(tft, 0, y + (lines - 1) * font.height, line, font, color, ST7735_BLACK, false);
+    start = next;
+  }
+  return lines;
+}
+
+// Title, divider and word-wrapped message on a freshly cleared screen
+void drawTitledMessage(const String& title, const String& message) {
   tft.fillScreen(ST7735_BLACK);
-  
-  // Display title with increased top margin
-  tft.setTextColor(ST7735_CYAN);
-  tft.setTextSize(getTitleTextSize());
-  tft.setCursor(0, TITLE_TOP_MARGIN);
-  tft.println(title);
-  
-  // Calculate title height
-  int titleTextHeight = getTitleTextSize() * 8;
-  int titleBottom = TITLE_TOP_MARGIN + titleTextHeight;
-  
+
+  // Display title with increased top margin, wrapped like the message
+  const FontAtlas& titleFont = fontForTextSize(getTitleTextSize());
+  int titleLines = drawWrappedText(TITLE_TOP_MARGIN, title, titleFont, ST7735_CYAN, TITLE_MAX_LINES);
+  if (titleLines == 0) titleLines = 1;
+  int titleBottom = TITLE_TOP_MARGIN + titleLines * titleFont.height;
+
   // Display horizontal line with spacing
   tft.drawFastHLine(0, titleBottom + TITLE_LINE_SPACING, tft.width(), ST7735_CYAN);
-  
-  // Display message with additional spacing
-  tft.setTextColor(ST7735_WHITE);
-  tft.setTextSize(getMessageTextSize());
-  
-  // Calculate starting Y position with more spacing
+
+  // Display message with additional spacing, as many lines as fit on screen
+  const FontAtlas& messageFont = fontForTextSize(getMessageTextSize());
   int messageStartY = titleBottom + TITLE_LINE_SPACING + LINE_MESSAGE_SPACING;
-  tft.setCursor(0, messageStartY);
-  
-  // Handle multiline messages with proper wrapping
-  int lineHeight = getMessageTextSize() * 8; // height of text in pixels
-  int maxLines = (tft.height() - messageStartY) / lineHeight; // max lines that fit on screen
-  
-  // Split the message by newline character
-  int lastSpace = 0;
-  int lineStart = 0;
-  int currentLine = 0;
-  
-  // Calculate characters per line based on text size
-  int charsPerLine = 21 / getMessageTextSize(); // Adjust this based on your display width
-  
-  for (int i = 0; i < message.length(); i++) {
-    // Check if we've hit a natural line break
-    if (message.charAt(i) == '\n') {
-      tft.setCursor(0, messageStartY + currentLine * lineHeight);
-      tft.println(message.substring(lineStart, i));
-      lineStart = i + 1;
-      currentLine++;
-      lastSpace = lineStart;
-      
-      if (currentLine >= maxLines) break;
-      continue;
-    }
-    
-    // Remember the position of spaces for word wrapping
-    if (message.charAt(i) == ' ') {
-      lastSpace = i;
-    }
-    
-    // Check if we need to wrap
-    if (i - lineStart > charsPerLine) {
-      // If we found a space to break at
-      if (lastSpace > lineStart) {
-        tft.setCursor(0, messageStartY + currentLine * lineHeight);
-        tft.println(message.substring(lineStart, lastSpace));
-        lineStart = lastSpace + 1;
-      } else {
-        // Hard break if no spaces
-        tft.setCursor(0, messageStartY + currentLine * lineHeight);
-        tft.println(message.substring(lineStart, i));
-        lineStart = i;
-      }
-      currentLine++;
-      
-      if (currentLine >= maxLines) break;
-    }
-  }
-  
-  // Print any remaining text
-  if (lineStart < message.length() && currentLine < maxLines) {
-    tft.setCursor(0, messageStartY + currentLine * lineHeight);
-    tft.println(message.substring(lineStart));
-  }
+  int maxLines = (tft.height() - messageStartY) / messageFont.height;
+  drawWrappedText(messageStartY, message, messageFont, ST7735_WHITE, maxLines);
+}
+
+// Show a temporary message with automatic timeout
+void showTemporaryMessage(String title, String message, unsigned long duration) {
+  drawTitledMessage(title, message);
   
   // Set timeout for message
   hasTemporaryMessage = true;
@@ -124,96 +229,30 @@ void showTemporaryMessage(String title, String message, unsigned long duration)
   
   // Update display state
   isShowingTime = false;
+  activeScreen = nullptr;
 }
 
 // Show an urgent alert with visual effects
 void showUrgentAlert(String title, String message) {
   // First display the message (without auto-timeout yet)
-  tft.fillScreen(ST7735_BLACK);
-  
-  // Display title with increased top margin
-  tft.setTextColor(ST7735_CYAN);
-  tft.setTextSize(getTitleTextSize());
-  tft.setCursor(0, TITLE_TOP_MARGIN);
-  tft.println(title);
-  
-  // Calculate title height
-  int titleTextHeight = getTitleTextSize() * 8;
-  int titleBottom = TITLE_TOP_MARGIN + titleTextHeight;
-  
-  // Display horizontal line with spacing
-  tft.drawFastHLine(0, titleBottom + TITLE_LINE_SPACING, tft.width(), ST7735_CYAN);
-  
-  // Display message with additional spacing
-  tft.setTextColor(ST7735_WHITE);
-  tft.setTextSize(getMessageTextSize());
-  
-  // Calculate starting Y position with more spacing
-  int messageStartY = titleBottom + TITLE_LINE_SPACING + LINE_MESSAGE_SPACING;
-  tft.setCursor(0, messageStartY);
-  
-  int lineHeight = getMessageTextSize() * 8;
-  int maxLines = (tft.height() - messageStartY) / lineHeight;
-  
-  int lastSpace = 0;
-  int lineStart = 0;
-  int currentLine = 0;
-  int charsPerLine = 21 / getMessageTextSize();
-  
-  for (int i = 0; i < message.length(); i++) {
-    if (message.charAt(i) == '\n') {
-      tft.setCursor(0, messageStartY + currentLine * lineHeight);
-      tft.println(message.substring(lineStart, i));
-      lineStart = i + 1;
-      currentLine++;
-      lastSpace = lineStart;
-      if (currentLine >= maxLines) break;
-      continue;
-    }
-    
-    if (message.charAt(i) == ' ') {
-      lastSpace = i;
-    }
-    
-    if (i - lineStart > charsPerLine) {
-      if (lastSpace > lineStart) {
-        tft.setCursor(0, messageStartY + currentLine * lineHeight);
-        tft.println(message.substring(lineStart, lastSpace));
-        lineStart = lastSpace + 1;
-      } else {
-        tft.setCursor(0, messageStartY + currentLine * lineHeight);
-        tft.println(message.substring(lineStart, i));
-        lineStart = i;
-      }
-      currentLine++;
-      if (currentLine >= maxLines) break;
-    }
-  }
-  
-  if (lineStart < message.length() && currentLine < maxLines) {
-    tft.setCursor(0, messageStartY + currentLine * lineHeight);
-    tft.println(message.substring(lineStart));
-  }
+  drawTitledMessage(title, message);
   
   // Then add emphasis with a blinking border to draw attention
   for (int i = 0; i < 3; i++) {
     // Draw a red border
-    for (int j = 0; j < 5; j++) {
-      tft.drawRect(j, j, tft.width() - j*2, tft.height() - j*2, ST7735_RED);
-    }
+    alertBorder.setColor(ST7735_RED);
+    alertBorder.render(tft);
     delay(200);
     
     // Remove the border
-    for (int j = 0; j < 5; j++) {
-      tft.drawRect(j, j, tft.width() - j*2, tft.height() - j*2, ST7735_BLACK);
-    }
+    alertBorder.setColor(ST7735_BLACK);
+    alertBorder.render(tft);
     delay(200);
   }
   
   // Redraw the border in a different color to show it's persistent
-  for (int j = 0; j < 5; j++) {
-    tft.drawRect(j, j, tft.width() - j*2, tft.height() - j*2, ST7735_YELLOW);
-  }
+  alertBorder.setColor(ST7735_YELLOW);
+  alertBorder.render(tft);
   
   // Use a longer timeout for urgent alerts (10 seconds)
   hasTemporaryMessage = true;
@@ -221,6 +260,88 @@ void showUrgentAlert(String title, String message) {
   temporaryMessageDuration = displaySettings.messageTimeout * 2; // Double the normal timeout
   
   isShowingTime = false;
+  activeScreen = nullptr;
+}
+
+static void copyText(char* dest, size_t size, const String& src) {
+  size_t len = my_min((size_t)src.length(), size - 1);
+  memcpy(dest, src.c_str(), len);
+  dest[len] = '\0';
+}
+
+static void queueRequest(DisplayRequestType type, const String& title, const String& text, unsigned long duration) {
+  DisplayRequest request;
+  request.type = type;
+  copyText(request.title, sizeof(request.title), title);
+  copyText(request.text, sizeof(request.text), text);
+  request.duration = duration;
+
+  portENTER_CRITICAL(&displayQueueMux);
+  if (displayQueueCount == DISPLAY_QUEUE_DEPTH) {
+    // The newest screen change wins, as it did when callbacks drew directly
+    displayQueueHead = (displayQueueHead + 1) % DISPLAY_QUEUE_DEPTH;
+    displayQueueCount--;
+  }
+  displayQueue[(displayQueueHead + displayQueueCount) % DISPLAY_QUEUE_DEPTH] = request;
+  displayQueueCount++;
+  portEXIT_CRITICAL(&displayQueueMux);
+}
+
+void queueMessage(const String& title, const String& message) {
+  queueRequest(REQUEST_MESSAGE, title, message, 0);
+}
+
+void queueTemporaryMessage(const String& title, const String& message, unsigned long duration) {
+  queueRequest(REQUEST_TEMPORARY_MESSAGE, title, message, duration);
+}
+
+void queueUrgentAlert(const String& title, const String& message) {
+  queueRequest(REQUEST_URGENT_ALERT, title, message, 0);
+}
+
+void queueTimeDisplay() {
+  queueRequest(REQUEST_TIME_DISPLAY, "", "", 0);
+}
+
+void queueDisplaySettings(const String& titleSize, const String& messageSize) {
+  queueRequest(REQUEST_DISPLAY_SETTINGS, titleSize, messageSize, 0);
+}
+
+// Carry out the queued screen changes in order; called from loop() only
+void processDisplayQueue() {
+  while (true) {
+    DisplayRequest request;
+    bool ready = false;
+    portENTER_CRITICAL(&displayQueueMux);
+    if (displayQueueCount > 0) {
+      request = displayQueue[displayQueueHead];
+      displayQueueHead = (displayQueueHead + 1) % DISPLAY_QUEUE_DEPTH;
+      displayQueueCount--;
+      ready = true;
+    }
+    portEXIT_CRITICAL(&displayQueueMux);
+    if (!ready) return;
+
+    switch (request.type) {
+      case REQUEST_MESSAGE:
+        showMessage(request.title, request.text);
+        break;
+      case REQUEST_TEMPORARY_MESSAGE:
+        showTemporaryMessage(request.title, request.text, request.duration);
+        break;
+      case REQUEST_URGENT_ALERT:
+        showUrgentAlert(request.title, request.text);
+        break;
+      case REQUEST_TIME_DISPLAY:
+        showTimeDisplay();
+        break;
+      case REQUEST_DISPLAY_SETTINGS:
+        displaySettings.titleSize = request.title;
+        displaySettings.messageSize = request.text;
+        applyDisplaySettings();
+        break;
+    }
+  }
 }
 
 // Simple time utility functions to replace TimeLib
@@ -244,12 +365,35 @@ String getCurrentTimeString() {
 
 // Display the time screen - adjusted for better positioning
 void showTimeDisplay() {
-  tft.fillScreen(ST7735_BLACK);
-  tft.setTextColor(ST7735_WHITE);
-  tft.setTextSize(2);
-  tft.setCursor(0, TITLE_TOP_MARGIN); // Use consistent top margin
-  tft.println("Current time:");
-  tft.setCursor(30, TITLE_TOP_MARGIN + 30); // Add space between title and time
-  tft.println(getCurrentTimeString());
+  activateScreen(&clockScreen);
+  updateTimeDisplay();
   isShowingTime = true;
-}
\ No newline at end of file
+}
+
+// Repaint only the clock digits that changed since the last tick
+void updateTimeDisplay() {
+  updateCurrentTime();
+  clockDigits.setTime(currentHour, currentMinute);
+  clockScreen.render(tft);
+}
+
+// Show the connect/disconnect status; if it is already up only the changed widgets repaint
+void showConnectionStatus(bool connected) {
+  activateScreen(&statusScreen);
+  statusIcon.setColor(connected ? ST7735_BLUE : STATUS_ICON_OFF_COLOR);
+  statusTitle.setText(connected ? "Connected" : "Disconnected");
+  setStatusMessage(connected ? "Device connected successfully" : "Waiting for connection...");
+  statusScreen.render(tft);
+
+  hasTemporaryMessage = true;
+  temporaryMessageStartTime = millis();
+  temporaryMessageDuration = STATUS_MESSAGE_DURATION;
+  isShowingTime = false;
+}
+
+// Blank the screen, e.g. once a temporary message has timed out
+void clearDisplay() {
+  tft.fillScreen(ST7735_BLACK);
+  activeScreen = nullptr;
+  isShowingTime = false;
+}
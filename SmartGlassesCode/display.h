@@ -7,6 +7,8 @@
 #include <SPI.h>
 #include <Arduino.h>
 #include "settings.h"
+#include "font.h"
+#include "widgets.h"
 
 #define TFT_CS 15    // Chip Select
 #define TFT_RST 2    // Reset
@@ -20,12 +22,36 @@
 #define TITLE_TOP_MARGIN 15      // Increase top margin for title
 #define TITLE_LINE_SPACING 5     // Space between title and line
 #define LINE_MESSAGE_SPACING 10  // Space between line and message start
+#define TITLE_MAX_LINES 2        // Long titles wrap onto a second line
+
+#define STATUS_MESSAGE_DURATION 3000  // How long connect/disconnect status stays up
+#define STATUS_ICON_OFF_COLOR 0x7BEF  // Grey bluetooth icon while disconnected
+#define STATUS_MESSAGE_LINES 2        // Status message is word-wrapped over this many lines
+
+#define DISPLAY_QUEUE_DEPTH 4         // Screen changes from BLE waiting for loop()
+#define DISPLAY_QUEUE_TITLE_LEN 64    // Longest queued title, including the terminator
+#define DISPLAY_QUEUE_TEXT_LEN 256    // Longest queued message, including the terminator
 
 void initDisplay();
 void showMessage(String title, String message);
 void showTemporaryMessage(String title, String message, unsigned long duration);
 void showUrgentAlert(String title, String message);
 void showTimeDisplay();
+void updateTimeDisplay();
+void showConnectionStatus(bool connected);
+void clearDisplay();
+void applyDisplaySettings();
+
+// Screen changes asked for from the Bluetooth task. The widgets are not
+// thread-safe, so BLE callbacks only queue these and processDisplayQueue()
+// carries them out from loop(). When the queue is full the oldest is dropped.
+void queueMessage(const String& title, const String& message);
+void queueTemporaryMessage(const String& title, const String& message, unsigned long duration);
+void queueUrgentAlert(const String& title, const String& message);
+void queueTimeDisplay();
+void queueDisplaySettings(const String& titleSize, const String& messageSize);
+void processDisplayQueue();
+
 String getCurrentTimeString();
 void updateCurrentTime();
 uint8_t getTitleTextSize();
@@ -0,0 +1,137 @@
+#include "font.h"
+#include "font_atlas.h"
+
+const FontAtlas& fontForTextSize(uint8_t textSize) {
+#if FONT_ANTIALIASED
+  return (textSize >= 2) ? font_large_aa : font_small_aa;
+#else
+  return (textSize >= 2) ? font_large : font_small;
+#endif
+}
+
+// Blend two RGB565 colors, alpha in 0..15 (15 = fully foreground)
+static uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  uint16_t r = (((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * (15 - alpha)) / 15;
+  uint16_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (15 - alpha)) / 15;
+  uint16_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * (15 - alpha)) / 15;
+  return (r << 11) | (g << 5) | b;
+}
+
+static const uint8_t* glyphFor(const FontAtlas& font, char c) {
+  uint8_t code = (uint8_t)c;
+  if (code < font.firstChar || code > font.lastChar) code = '?';
+  return font.bitmap + (size_t)(code - font.firstChar) * font.height * font.rowBytes;
+}
+
+// Coverage values are 0..15; the transparent path flags pixels it has sent
+#define COVERAGE_MASK 0x0F
+#define COVERAGE_SENT 0x80
+
+static bool unsentInk(uint8_t coverage) {
+  return coverage != 0 && !(coverage & COVERAGE_SENT);
+}
+
+// Coverage (0..15) of one scanline of the run, spanWidth pixels wide
+static void coverageRow(const FontAtlas& font, const String& text, int16_t row, int32_t spanWidth, uint8_t* out) {
+  int32_t remaining = spanWidth;
+  for (unsigned int i = 0; remaining > 0; i++) {
+    const uint8_t* src = glyphFor(font, text.charAt(i)) + row * font.rowBytes;
+    uint8_t cols = my_min((int32_t)font.advance, remaining);
+    if (font.bpp == 1) {
+      for (uint8_t c = 0; c < cols; c++) {
+        out[c] = (src[c >> 3] & (0x80 >> (c & 7))) ? 15 : 0;
+      }
+    } else {
+      for (uint8_t c = 0; c < cols; c++) {
+        out[c] = (c & 1) ? (src[c >> 1] & 0x0F) : (src[c >> 1] >> 4);
+      }
+    }
+    out += cols;
+    remaining -= cols;
+  }
+}
+
+int16_t drawText(Adafruit_SPITFT& tft, int16_t x, int16_t y, const String& text,
+                 const FontAtlas& font, uint16_t color, uint16_t background, bool opaque) {
+  if (x < 0 || y < 0 || x >= tft.width() || y >= tft.height() || text.length() == 0) {
+    return x;
+  }
+
+  // Clip the run to the screen and the span buffer
+  int32_t spanWidth = (int32_t)text.length() * font.advance;
+  spanWidth = my_min(spanWidth, (int32_t)(tft.width() - x));
+  spanWidth = my_min(spanWidth, (int32_t)FONT_MAX_SPAN_WIDTH);
+  int16_t rows = my_min((int16_t)font.height, (int16_t)(tft.height() - y));
+  rows = my_min(rows, (int16_t)FONT_MAX_LINE_HEIGHT);
+
+  // Coverage -> color lookup, so the inner loop is a table read per pixel
+  uint16_t palette[16];
+  for (uint8_t a = 0; a < 16; a++) {
+    palette[a] = blend565(color, background, a);
+  }
+
+  static uint8_t coverage[FONT_MAX_LINE_HEIGHT][FONT_MAX_SPAN_WIDTH];
+  static uint16_t span[FONT_MAX_SPAN_WIDTH];
+
+  tft.startWrite();
+  if (opaque) {
+    // Whole cells in one window, so whatever was under the text is replaced
+    tft.setAddrWindow(x, y, spanWidth, rows);
+    for (int16_t row = 0; row < rows; row++) {
+      coverageRow(font, text, row, spanWidth, coverage[0]);
+      for (int32_t c = 0; c < spanWidth; c++) {
+        span[c] = palette[coverage[0][c]];
+      }
+      tft.writePixels(span, spanWidth);
+    }
+  } else {
+    // The area already holds the background: send only rectangles that carry
+    // ink, so blank rows and the space around glyphs cost nothing
+    for (int16_t row = 0; row < rows; row++) {
+      coverageRow(font, text, row, spanWidth, coverage[row]);
+    }
+    for (int16_t row = 0; row < rows; row++) {
+      const uint8_t* line = coverage[row];
+      int32_t c = 0;
+      while (c < spanWidth) {
+        if (!unsentInk(line[c])) {
+          c++;
+          continue;
+        }
+        // Extend the run over gaps too short to be worth a new window
+        int32_t start = c;
+        int32_t end = c + 1;
+        for (int32_t k = end; k < spanWidth && k - end <= FONT_RUN_MERGE_GAP; k++) {
+          if (unsentInk(line[k])) end = k + 1;
+        }
+        int32_t width = end - start;
+
+        // Grow the window down while the rows below still need most of it, as
+        // on vertical strokes
+        int16_t height = 1;
+        while (row + height < rows) {
+          int32_t waste = 0;
+          for (int32_t k = start; k < end; k++) {
+            if (!unsentInk(coverage[row + height][k])) waste++;
+          }
+          if (waste > FONT_RUN_MERGE_GAP || waste == width) break;
+          height++;
+        }
+
+        // Pixels sent earlier are sent again with the same color, never as background
+        tft.setAddrWindow(x + start, y + row, width, height);
+        for (int16_t r = row; r < row + height; r++) {
+          for (int32_t k = start; k < end; k++) {
+            span[k - start] = palette[coverage[r][k] & COVERAGE_MASK];
+            coverage[r][k] |= COVERAGE_SENT;
+          }
+          tft.writePixels(span, width);
+        }
+        c = end;
+      }
+    }
+  }
+  tft.endWrite();
+
+  return x + spanWidth;
+}
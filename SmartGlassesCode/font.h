@@ -0,0 +1,55 @@
+#ifndef FONT_H
+#define FONT_H
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SPITFT.h>
+#include <Arduino.h>
+
+// Set to 0 to use the 1bpp atlases instead of the 4bpp anti-aliased ones
+#ifndef FONT_ANTIALIASED
+#define FONT_ANTIALIASED 1
+#endif
+
+#ifndef CUSTOM_MIN_DEFINED
+#define CUSTOM_MIN_DEFINED
+  #define my_min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+// Widest text run pushed in one go (display width in landscape rotation)
+#define FONT_MAX_SPAN_WIDTH 160
+// Tallest atlas cell drawText() handles (the large atlas is 17 rows)
+#define FONT_MAX_LINE_HEIGHT 20
+
+// Background pixels a transparent window may cover to save opening another
+// one, both between runs on a row and per row when stacking runs; tuned with
+// test/font_bench
+#define FONT_RUN_MERGE_GAP 2
+
+// Pre-rasterized monospaced font, generated by tools/gen_font_atlas.py.
+// Glyphs are stored back to back as advance x height cells, row by row.
+struct FontAtlas {
+  uint8_t firstChar;
+  uint8_t lastChar;
+  uint8_t advance;        // cell width in pixels
+  uint8_t height;         // cell height in pixels (also the line height)
+  uint8_t bpp;            // 1 = monochrome, 4 = anti-aliased coverage
+  uint8_t rowBytes;       // bytes per glyph row
+  const uint8_t* bitmap;
+};
+
+// Atlas backing a given text size (1 = small, 2 = large)
+const FontAtlas& fontForTextSize(uint8_t textSize);
+
+// Draw a single line of text with its top-left corner at (x, y). Text past the
+// right edge is clipped. Returns the x position after the last glyph.
+//
+// opaque = true paints whole character cells, one address window for the line
+// and one scanline at a time from a span buffer, replacing whatever was there
+// (used for in-place updates such as the retained labels). opaque = false is
+// for an area that was just cleared to background: only windows around the
+// ink are sent, stacked over rows where strokes line up, which is far less SPI
+// traffic than whole cells.
+int16_t drawText(Adafruit_SPITFT& tft, int16_t x, int16_t y, const String& text,
+                 const FontAtlas& font, uint16_t color, uint16_t background, bool opaque = true);
+
+#endif
@@ -0,0 +1,419 @@
+// Generated by tools/gen_font_atlas.py from DejaVuSansMono.ttf - do not edit by hand.
+#ifndef FONT_ATLAS_H
+#define FONT_ATLAS_H
+
+#include "font.h"
+
+// 6x10 cells, 1bpp, 1 bytes per row
+static constexpr uint8_t font_small_bitmap[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00,  // '!'
+  0x00, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+  0x00, 0x28, 0x28, 0x7C, 0x50, 0xF8, 0x50, 0x50, 0x00, 0x00,  // '#'
+  0x00, 0x10, 0x3C, 0x50, 0x70, 0x1C, 0x14, 0x78, 0x10, 0x00,  // '$'
+  0x00, 0xE0, 0xA0, 0xE8, 0x30, 0x5C, 0x14, 0x1C, 0x00, 0x00,  // '%'
+  0x00, 0x38, 0x20, 0x30, 0x54, 0x4C, 0x48, 0x34, 0x00, 0x00,  // '&'
+  0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+  0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x00,  // '('
+  0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x00,  // ')'
+  0x00, 0x54, 0x38, 0x38, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+  0x00, 0x00, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x00, 0x00, 0x00,  // '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,  // ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,  // '.'
+  0x00, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x00,  // '/'
+  0x00, 0x38, 0x44, 0x44, 0x54, 0x44, 0x44, 0x38, 0x00, 0x00,  // '0'
+  0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00,  // '1'
+  0x00, 0x38, 0x44, 0x04, 0x0C, 0x18, 0x20, 0x7C, 0x00, 0x00,  // '2'
+  0x00, 0x38, 0x44, 0x04, 0x38, 0x04, 0x44, 0x38, 0x00, 0x00,  // '3'
+  0x00, 0x08, 0x18, 0x28, 0x68, 0x7C, 0x08, 0x08, 0x00, 0x00,  // '4'
+  0x00, 0x78, 0x40, 0x78, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00,  // '5'
+  0x00, 0x3C, 0x60, 0x40, 0x78, 0x44, 0x44, 0x38, 0x00, 0x00,  // '6'
+  0x00, 0x7C, 0x0C, 0x08, 0x08, 0x10, 0x10, 0x20, 0x00, 0x00,  // '7'
+  0x00, 0x38, 0x44, 0x44, 0x38, 0x44, 0x44, 0x38, 0x00, 0x00,  // '8'
+  0x00, 0x38, 0x44, 0x44, 0x3C, 0x04, 0x0C, 0x78, 0x00, 0x00,  // '9'
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,  // ':'
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,  // ';'
+  0x00, 0x00, 0x04, 0x38, 0x40, 0x38, 0x04, 0x00, 0x00, 0x00,  // '<'
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,  // '='
+  0x00, 0x00, 0x40, 0x38, 0x04, 0x38, 0x40, 0x00, 0x00, 0x00,  // '>'
+  0x00, 0x78, 0x08, 0x10, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,  // '?'
+  0x00, 0x38, 0x24, 0x5C, 0x54, 0x54, 0x54, 0x5C, 0x20, 0x18,  // '@'
+  0x00, 0x10, 0x10, 0x28, 0x28, 0x38, 0x44, 0x44, 0x00, 0x00,  // 'A'
+  0x00, 0x78, 0x44, 0x44, 0x78, 0x44, 0x44, 0x78, 0x00, 0x00,  // 'B'
+  0x00, 0x3C, 0x64, 0x40, 0x40, 0x40, 0x64, 0x3C, 0x00, 0x00,  // 'C'
+  0x00, 0x78, 0x4C, 0x44, 0x44, 0x44, 0x4C, 0x78, 0x00, 0x00,  // 'D'
+  0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x7C, 0x00, 0x00,  // 'E'
+  0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x00, 0x00,  // 'F'
+  0x00, 0x38, 0x64, 0x40, 0x4C, 0x44, 0x64, 0x3C, 0x00, 0x00,  // 'G'
+  0x00, 0x44, 0x44, 0x44, 0x7C, 0x44, 0x44, 0x44, 0x00, 0x00,  // 'H'
+  0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00,  // 'I'
+  0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x48, 0x30, 0x00, 0x00,  // 'J'
+  0x00, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x00, 0x00,  // 'K'
+  0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x00, 0x00,  // 'L'
+  0x00, 0x44, 0x6C, 0x6C, 0x54, 0x44, 0x44, 0x44, 0x00, 0x00,  // 'M'
+  0x00, 0x44, 0x64, 0x64, 0x54, 0x4C, 0x4C, 0x44, 0x00, 0x00,  // 'N'
+  0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,  // 'O'
+  0x00, 0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x40, 0x00, 0x00,  // 'P'
+  0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x0C, 0x00,  // 'Q'
+  0x00, 0x78, 0x44, 0x44, 0x78, 0x4C, 0x44, 0x40, 0x00, 0x00,  // 'R'
+  0x00, 0x38, 0x44, 0x40, 0x38, 0x04, 0x44, 0x38, 0x00, 0x00,  // 'S'
+  0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,  // 'T'
+  0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,  // 'U'
+  0x00, 0x44, 0x44, 0x28, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00,  // 'V'
+  0x00, 0x84, 0xB4, 0xB4, 0x78, 0x48, 0x48, 0x48, 0x00, 0x00,  // 'W'
+  0x00, 0x44, 0x28, 0x28, 0x10, 0x28, 0x28, 0x44, 0x00, 0x00,  // 'X'
+  0x00, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,  // 'Y'
+  0x00, 0x7C, 0x08, 0x08, 0x10, 0x20, 0x20, 0x7C, 0x00, 0x00,  // 'Z'
+  0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x00,  // '['
+  0x00, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x00,  // 'backslash'
+  0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x00,  // ']'
+  0x00, 0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,  // '_'
+  0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+  0x00, 0x00, 0x00, 0x78, 0x04, 0x3C, 0x44, 0x7C, 0x00, 0x00,  // 'a'
+  0x40, 0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x78, 0x00, 0x00,  // 'b'
+  0x00, 0x00, 0x00, 0x38, 0x40, 0x40, 0x40, 0x38, 0x00, 0x00,  // 'c'
+  0x04, 0x04, 0x04, 0x3C, 0x44, 0x44, 0x44, 0x3C, 0x00, 0x00,  // 'd'
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x7C, 0x40, 0x3C, 0x00, 0x00,  // 'e'
+  0x18, 0x20, 0x20, 0x78, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,  // 'f'
+  0x00, 0x00, 0x00, 0x3C, 0x44, 0x44, 0x44, 0x3C, 0x04, 0x38,  // 'g'
+  0x40, 0x40, 0x40, 0x58, 0x64, 0x44, 0x44, 0x44, 0x00, 0x00,  // 'h'
+  0x10, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00,  // 'i'
+  0x10, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x60,  // 'j'
+  0x40, 0x40, 0x40, 0x48, 0x50, 0x70, 0x48, 0x44, 0x00, 0x00,  // 'k'
+  0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18, 0x00, 0x00,  // 'l'
+  0x00, 0x00, 0x00, 0x7C, 0x54, 0x54, 0x54, 0x54, 0x00, 0x00,  // 'm'
+  0x00, 0x00, 0x00, 0x58, 0x64, 0x44, 0x44, 0x44, 0x00, 0x00,  // 'n'
+  0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00,  // 'o'
+  0x00, 0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x78, 0x40, 0x40,  // 'p'
+  0x00, 0x00, 0x00, 0x3C, 0x44, 0x44, 0x44, 0x3C, 0x04, 0x04,  // 'q'
+  0x00, 0x00, 0x00, 0x3C, 0x24, 0x20, 0x20, 0x20, 0x00, 0x00,  // 'r'
+  0x00, 0x00, 0x00, 0x3C, 0x40, 0x3C, 0x04, 0x78, 0x00, 0x00,  // 's'
+  0x00, 0x20, 0x20, 0x78, 0x20, 0x20, 0x20, 0x38, 0x00, 0x00,  // 't'
+  0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x00, 0x00,  // 'u'
+  0x00, 0x00, 0x00, 0x44, 0x28, 0x28, 0x28, 0x10, 0x00, 0x00,  // 'v'
+  0x00, 0x00, 0x00, 0x44, 0x54, 0x28, 0x28, 0x28, 0x00, 0x00,  // 'w'
+  0x00, 0x00, 0x00, 0x6C, 0x28, 0x10, 0x28, 0x6C, 0x00, 0x00,  // 'x'
+  0x00, 0x00, 0x00, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x60,  // 'y'
+  0x00, 0x00, 0x00, 0x7C, 0x08, 0x10, 0x20, 0x7C, 0x00, 0x00,  // 'z'
+  0x18, 0x10, 0x10, 0x10, 0x60, 0x10, 0x10, 0x10, 0x18, 0x00,  // '{'
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,  // '|'
+  0x30, 0x10, 0x10, 0x10, 0x0C, 0x10, 0x10, 0x10, 0x30, 0x00,  // '}'
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x00,  // '~'
+};
+
+static constexpr FontAtlas font_small = {
+  0x20, 0x7E, 6, 10, 1, 1, font_small_bitmap
+};
+
+// 6x10 cells, 4bpp, 3 bytes per row
+static constexpr uint8_t font_small_aa_bitmap[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x77, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+  0x00, 0x00, 0x00, 0x05, 0x87, 0x60, 0x05, 0x87, 0x60, 0x05, 0x87, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+  0x00, 0x00, 0x00, 0x00, 0x93, 0x93, 0x00, 0xC0, 0xC0, 0x6F, 0xFF, 0xFF, 0x05, 0x75, 0x60, 0xFF, 0xFF, 0xF7, 0x0C, 0x0C, 0x00, 0x1A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x07, 0xEF, 0xF0, 0x0E, 0x36, 0x00, 0x0C, 0x98, 0x00, 0x00, 0x5B, 0xD2, 0x00, 0x16, 0xA6, 0x1F, 0xEF, 0xA0, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,  // '$'
+  0x00, 0x00, 0x00, 0x6F, 0xB0, 0x00, 0xC2, 0x93, 0x00, 0x6F, 0xB2, 0x85, 0x01, 0x77, 0x00, 0x48, 0x2B, 0xF6, 0x00, 0x3A, 0x2B, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+  0x00, 0x00, 0x00, 0x06, 0xEF, 0x40, 0x0C, 0x20, 0x00, 0x09, 0xA0, 0x00, 0x57, 0x78, 0x0C, 0xA3, 0x0A, 0x7A, 0x8A, 0x13, 0xF4, 0x0A, 0xFC, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+  0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+  0x00, 0x0B, 0x10, 0x00, 0x39, 0x00, 0x00, 0x94, 0x00, 0x00, 0xD1, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x94, 0x00, 0x00, 0x39, 0x00, 0x00, 0x0B, 0x10, 0x00, 0x00, 0x00,  // '('
+  0x01, 0xB0, 0x00, 0x00, 0x94, 0x00, 0x00, 0x49, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x49, 0x00, 0x00, 0x94, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00,  // ')'
+  0x00, 0x00, 0x00, 0x09, 0x45, 0x91, 0x03, 0xCC, 0x30, 0x03, 0xCC, 0x30, 0x09, 0x45, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0xA7, 0x00, 0x00, 0xD0, 0x00,  // ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x06, 0x80, 0x00, 0x0D, 0x10, 0x00, 0x59, 0x00, 0x00, 0xC2, 0x00, 0x04, 0xA0, 0x00, 0x0C, 0x20, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+  0x00, 0x00, 0x00, 0x05, 0xEE, 0x50, 0x0E, 0x33, 0xE1, 0x3B, 0x00, 0xB4, 0x5A, 0x77, 0xA5, 0x3B, 0x00, 0xB4, 0x0E, 0x33, 0xE1, 0x05, 0xEE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+  0x00, 0x00, 0x00, 0x0C, 0xFD, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x0B, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+  0x00, 0x00, 0x00, 0x08, 0xEE, 0x60, 0x37, 0x13, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x09, 0x50, 0x00, 0x96, 0x00, 0x0A, 0x50, 0x00, 0x4F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+  0x00, 0x00, 0x00, 0x06, 0xEE, 0x50, 0x18, 0x12, 0xF0, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0x50, 0x00, 0x02, 0xD1, 0x46, 0x02, 0xE2, 0x09, 0xEE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+  0x00, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x98, 0x90, 0x05, 0x56, 0x90, 0x19, 0x06, 0x90, 0x7F, 0xFF, 0xF8, 0x00, 0x06, 0x90, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x0E, 0x00, 0x00, 0x0F, 0xFD, 0x40, 0x00, 0x04, 0xE0, 0x00, 0x00, 0xC2, 0x00, 0x04, 0xE0, 0x4F, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+  0x00, 0x00, 0x00, 0x03, 0xCF, 0xD0, 0x0E, 0x60, 0x00, 0x3C, 0x00, 0x00, 0x5B, 0xCF, 0x90, 0x4E, 0x11, 0xC4, 0x0D, 0x11, 0xC4, 0x05, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF3, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x60, 0x00, 0x0D, 0x10, 0x00, 0x5A, 0x00, 0x00, 0xB3, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+  0x00, 0x00, 0x00, 0x07, 0xEE, 0x70, 0x1E, 0x11, 0xE2, 0x0D, 0x11, 0xD1, 0x06, 0xFF, 0x70, 0x3C, 0x11, 0xC3, 0x4D, 0x11, 0xC4, 0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+  0x00, 0x00, 0x00, 0x09, 0xFE, 0x50, 0x4C, 0x11, 0xD0, 0x4C, 0x11, 0xE3, 0x0A, 0xFC, 0xB5, 0x00, 0x00, 0xC3, 0x00, 0x06, 0xE0, 0x0D, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0xA7, 0x00, 0x00, 0xD0, 0x00,  // ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88, 0x05, 0xBB, 0x50, 0x8E, 0x30, 0x00, 0x05, 0xBB, 0x50, 0x00, 0x02, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x20, 0x00, 0x05, 0xBB, 0x50, 0x00, 0x03, 0xD9, 0x05, 0xBC, 0x50, 0x79, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x0A, 0x80, 0x00, 0x69, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+  0x00, 0x00, 0x00, 0x04, 0xDF, 0xB1, 0x1D, 0x40, 0x68, 0x84, 0x4E, 0xAB, 0xB0, 0xC2, 0x4C, 0xB0, 0xC0, 0x0B, 0xC0, 0xC2, 0x4C, 0x85, 0x4E, 0xAB, 0x1D, 0x51, 0x00, 0x02, 0xBF, 0xD0,  // '@'
+  0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xCB, 0x10, 0x06, 0x76, 0x60, 0x0B, 0x21, 0xB0, 0x0F, 0xFF, 0xF1, 0x59, 0x00, 0x95, 0xA5, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+  0x00, 0x00, 0x00, 0x3F, 0xFE, 0x80, 0x3C, 0x01, 0xD3, 0x3C, 0x01, 0xD2, 0x3F, 0xFF, 0xA0, 0x3C, 0x00, 0xA5, 0x3C, 0x00, 0xA7, 0x3F, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+  0x00, 0x00, 0x00, 0x02, 0xBF, 0xA0, 0x0D, 0x60, 0x53, 0x3D, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0D, 0x60, 0x53, 0x02, 0xCF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+  0x00, 0x00, 0x00, 0x5F, 0xFC, 0x30, 0x5A, 0x05, 0xE0, 0x5A, 0x00, 0xC4, 0x5A, 0x00, 0xA5, 0x5A, 0x00, 0xC4, 0x5A, 0x05, 0xE0, 0x5F, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF2, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x0D, 0x20, 0x00, 0x0D, 0x20, 0x00, 0x0D, 0xFF, 0xF2, 0x0D, 0x20, 0x00, 0x0D, 0x20, 0x00, 0x0D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+  0x00, 0x00, 0x00, 0x03, 0xCE, 0x80, 0x1E, 0x41, 0x62, 0x5A, 0x00, 0x00, 0x78, 0x09, 0xF6, 0x5A, 0x00, 0x86, 0x1E, 0x40, 0x96, 0x04, 0xDF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+  0x00, 0x00, 0x00, 0x5A, 0x00, 0xA5, 0x5A, 0x00, 0xA5, 0x5A, 0x00, 0xA5, 0x5F, 0xFF, 0xF5, 0x5A, 0x00, 0xA5, 0x5A, 0x00, 0xA5, 0x5A, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 0x05, 0xA0, 0x00, 0x05, 0xA0, 0x00, 0x05, 0xA0, 0x00, 0x05, 0xA0, 0x64, 0x09, 0x80, 0x1B, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+  0x00, 0x00, 0x00, 0x5A, 0x00, 0xB6, 0x5A, 0x0B, 0x60, 0x5A, 0xB6, 0x00, 0x5F, 0xC8, 0x00, 0x5B, 0x0D, 0x30, 0x5A, 0x03, 0xD0, 0x5A, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+  0x00, 0x00, 0x00, 0x9E, 0x00, 0xE9, 0x9B, 0x55, 0xB9, 0x95, 0xAA, 0x59, 0x95, 0x99, 0x59, 0x95, 0x00, 0x59, 0x95, 0x00, 0x59, 0x95, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+  0x00, 0x00, 0x00, 0x5F, 0x20, 0x95, 0x5E, 0x90, 0x95, 0x5A, 0xC0, 0x95, 0x5A, 0x66, 0x95, 0x5A, 0x0C, 0x95, 0x5A, 0x08, 0xD5, 0x5A, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+  0x00, 0x00, 0x00, 0x06, 0xEE, 0x60, 0x1E, 0x22, 0xE1, 0x5B, 0x00, 0xA5, 0x6A, 0x00, 0x96, 0x5B, 0x00, 0xA5, 0x1E, 0x22, 0xE1, 0x06, 0xEE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x0F, 0x00, 0xB7, 0x0F, 0x00, 0xB7, 0x0F, 0xFF, 0xB1, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+  0x00, 0x00, 0x00, 0x06, 0xEE, 0x60, 0x1E, 0x22, 0xE1, 0x5B, 0x00, 0xA5, 0x6A, 0x00, 0x96, 0x5B, 0x00, 0xA5, 0x1E, 0x22, 0xE1, 0x06, 0xEF, 0x70, 0x00, 0x04, 0xA0, 0x00, 0x00, 0x00,  // 'Q'
+  0x00, 0x00, 0x00, 0x4F, 0xFE, 0x70, 0x4B, 0x02, 0xF1, 0x4B, 0x02, 0xE1, 0x4F, 0xFF, 0x40, 0x4B, 0x06, 0xB0, 0x4B, 0x00, 0xC4, 0x4B, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+  0x00, 0x00, 0x00, 0x08, 0xEE, 0x50, 0x3D, 0x11, 0x90, 0x3C, 0x00, 0x00, 0x05, 0xAA, 0x50, 0x00, 0x00, 0xB3, 0x37, 0x11, 0xD4, 0x08, 0xEE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+  0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+  0x00, 0x00, 0x00, 0x4B, 0x00, 0xB4, 0x4B, 0x00, 0xB4, 0x4B, 0x00, 0xB4, 0x4B, 0x00, 0xB4, 0x4B, 0x00, 0xB4, 0x2D, 0x11, 0xD2, 0x07, 0xEE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+  0x00, 0x00, 0x00, 0x96, 0x00, 0x69, 0x4B, 0x00, 0xB4, 0x0E, 0x00, 0xE0, 0x0A, 0x43, 0xA0, 0x05, 0x88, 0x50, 0x01, 0xCC, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+  0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0xC2, 0x00, 0x1C, 0x94, 0xAA, 0x3A, 0x76, 0xBB, 0x57, 0x49, 0x99, 0x95, 0x2E, 0x65, 0xE2, 0x0F, 0x21, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+  0x00, 0x00, 0x00, 0x4C, 0x00, 0x96, 0x09, 0x63, 0xC0, 0x01, 0xDC, 0x20, 0x00, 0xAC, 0x00, 0x04, 0xB9, 0x50, 0x0D, 0x21, 0xD1, 0x97, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x88, 0x0D, 0x21, 0xD0, 0x04, 0xAA, 0x50, 0x00, 0xBB, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+  0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xC1, 0x00, 0x09, 0x40, 0x00, 0x49, 0x00, 0x01, 0xB0, 0x00, 0x0A, 0x20, 0x00, 0x3F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+  0x00, 0xBF, 0x50, 0x00, 0xB2, 0x00, 0x00, 0xB2, 0x00, 0x00, 0xB2, 0x00, 0x00, 0xB2, 0x00, 0x00, 0xB2, 0x00, 0x00, 0xB2, 0x00, 0x00, 0xB2, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00,  // '['
+  0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x0C, 0x20, 0x00, 0x04, 0xA0, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x59, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x06, 0x80, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00,  // 'backslash'
+  0x05, 0xFC, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00,  // ']'
+  0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x08, 0x77, 0x80, 0x4A, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,  // '_'
+  0x04, 0xA0, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x60, 0x00, 0x01, 0xD1, 0x0A, 0xFF, 0xF2, 0x4B, 0x12, 0xE2, 0x1C, 0xFB, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+  0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D, 0xAF, 0x90, 0x1F, 0x31, 0xC4, 0x1E, 0x00, 0x86, 0x1F, 0x31, 0xC4, 0x1D, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xF3, 0x0D, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x02, 0xCF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+  0x00, 0x00, 0xD1, 0x00, 0x00, 0xD1, 0x00, 0x00, 0xD1, 0x08, 0xFB, 0xD1, 0x3D, 0x13, 0xF1, 0x59, 0x00, 0xD1, 0x3D, 0x13, 0xF1, 0x08, 0xFB, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0x90, 0x2D, 0x10, 0xB4, 0x5F, 0xFF, 0xF6, 0x3C, 0x10, 0x00, 0x06, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+  0x00, 0x1D, 0xF3, 0x00, 0x77, 0x00, 0x00, 0x95, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFB, 0xD1, 0x3D, 0x13, 0xF1, 0x59, 0x00, 0xD1, 0x3D, 0x13, 0xF1, 0x09, 0xFB, 0xD1, 0x00, 0x02, 0xE0, 0x0C, 0xFE, 0x40,  // 'g'
+  0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0xAF, 0x80, 0x0F, 0x31, 0xE0, 0x0D, 0x00, 0xC1, 0x0D, 0x00, 0xC2, 0x0D, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+  0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x58, 0x00, 0x00, 0x58, 0x00, 0x00, 0x58, 0x00, 0x2F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+  0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x4C, 0x00, 0x1F, 0xE4, 0x00,  // 'j'
+  0x0D, 0x10, 0x00, 0x0D, 0x10, 0x00, 0x0D, 0x10, 0x00, 0x0D, 0x13, 0xC1, 0x0D, 0x6B, 0x10, 0x0D, 0xBC, 0x00, 0x0D, 0x16, 0xA0, 0x0D, 0x10, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+  0x3F, 0xF2, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xE8, 0xE3, 0x77, 0x88, 0x67, 0x75, 0x67, 0x48, 0x75, 0x67, 0x48, 0x75, 0x67, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xAF, 0x80, 0x0F, 0x31, 0xE0, 0x0D, 0x00, 0xC1, 0x0D, 0x00, 0xC2, 0x0D, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x70, 0x2D, 0x11, 0xD2, 0x4A, 0x00, 0xA5, 0x2E, 0x11, 0xD2, 0x07, 0xEE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xBF, 0x90, 0x1F, 0x31, 0xC3, 0x1D, 0x00, 0x95, 0x1F, 0x31, 0xC3, 0x1D, 0xBF, 0x90, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00,  // 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEC, 0xC2, 0x2D, 0x12, 0xF2, 0x4A, 0x00, 0xC2, 0x2D, 0x12, 0xF2, 0x08, 0xFC, 0xC2, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xC2,  // 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0xFA, 0x03, 0xE3, 0x00, 0x03, 0xB0, 0x00, 0x03, 0xA0, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x0E, 0x20, 0x00, 0x05, 0xBC, 0x60, 0x00, 0x01, 0xE0, 0x0F, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x5F, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xC2, 0x0D, 0x00, 0xC2, 0x0D, 0x00, 0xC2, 0x0E, 0x12, 0xF2, 0x07, 0xFB, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x95, 0x0D, 0x00, 0xD0, 0x08, 0x55, 0x80, 0x02, 0xBB, 0x20, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x93, 0x00, 0x3A, 0x57, 0x88, 0x65, 0x1B, 0x99, 0xA1, 0x0D, 0x54, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x11, 0xC1, 0x03, 0xBB, 0x30, 0x00, 0xBB, 0x00, 0x06, 0x99, 0x60, 0x3C, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x86, 0x0C, 0x10, 0xD0, 0x06, 0x75, 0x80, 0x00, 0xCC, 0x10, 0x00, 0x8B, 0x00, 0x00, 0xC5, 0x00, 0x1F, 0xA0, 0x00,  // 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF0, 0x00, 0x05, 0x50, 0x00, 0x45, 0x00, 0x04, 0x60, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+  0x00, 0x1D, 0xE0, 0x00, 0x59, 0x00, 0x00, 0x67, 0x00, 0x00, 0x96, 0x00, 0x0E, 0xE1, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x67, 0x00, 0x00, 0x59, 0x00, 0x00, 0x1D, 0xE0, 0x00, 0x00, 0x00,  // '{'
+  0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00,  // '|'
+  0x0E, 0xD1, 0x00, 0x00, 0x96, 0x00, 0x00, 0x76, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x6A, 0x00, 0x00, 0x76, 0x00, 0x00, 0x96, 0x00, 0x0E, 0xD1, 0x00, 0x00, 0x00, 0x00,  // '}'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xD4, 0x16, 0x52, 0x3C, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+};
+
+static constexpr FontAtlas font_small_aa = {
+  0x20, 0x7E, 6, 10, 4, 3, font_small_aa_bitmap
+};
+
+// 10x17 cells, 1bpp, 2 bytes per row
+static constexpr uint8_t font_large_bitmap[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+  0x00, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x09, 0x00, 0x09, 0x00, 0x7F, 0xC0, 0x13, 0x00, 0x12, 0x00, 0x12, 0x00, 0xFF, 0x80, 0x26, 0x00, 0x24, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+  0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x34, 0x80, 0x24, 0x00, 0x24, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x04, 0x80, 0x04, 0x80, 0x24, 0x80, 0x1F, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  // '$'
+  0x00, 0x00, 0x70, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x71, 0x00, 0x06, 0x00, 0x18, 0x00, 0x67, 0x00, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+  0x00, 0x00, 0x1E, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x28, 0x00, 0x6C, 0x80, 0x44, 0x80, 0x42, 0x80, 0x43, 0x00, 0x23, 0x00, 0x1E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+  0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+  0x00, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,  // '('
+  0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  // ')'
+  0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x49, 0x00, 0x3E, 0x00, 0x1C, 0x00, 0x6B, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00,  // ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+  0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x4C, 0x80, 0x4C, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+  0x00, 0x00, 0x1C, 0x00, 0x34, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+  0x00, 0x00, 0x3E, 0x00, 0x61, 0x00, 0x40, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x30, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+  0x00, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x1E, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x41, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+  0x00, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x12, 0x00, 0x22, 0x00, 0x22, 0x00, 0x42, 0x00, 0x7F, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+  0x00, 0x00, 0x3F, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x21, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x41, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+  0x00, 0x00, 0x1E, 0x00, 0x31, 0x00, 0x20, 0x00, 0x40, 0x00, 0x5E, 0x00, 0x61, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+  0x00, 0x00, 0x1E, 0x00, 0x61, 0x80, 0x40, 0x80, 0x40, 0x80, 0x61, 0x80, 0x1E, 0x00, 0x21, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+  0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x80, 0x1E, 0x80, 0x00, 0x80, 0x01, 0x00, 0x23, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00,  // ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x80, 0x1C, 0x00, 0x70, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x03, 0x80, 0x0E, 0x00, 0x78, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+  0x00, 0x00, 0x1E, 0x00, 0x23, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x11, 0x80, 0x20, 0x80, 0x27, 0x80, 0x4D, 0x80, 0x48, 0x80, 0x48, 0x80, 0x48, 0x80, 0x48, 0x80, 0x4D, 0x80, 0x27, 0x80, 0x20, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x00,  // '@'
+  0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x21, 0x00, 0x21, 0x00, 0x3F, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+  0x00, 0x00, 0x7E, 0x00, 0x41, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x80, 0x7E, 0x00, 0x41, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+  0x00, 0x00, 0x0F, 0x00, 0x31, 0x80, 0x20, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x31, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+  0x00, 0x00, 0x7C, 0x00, 0x43, 0x00, 0x41, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x00, 0x43, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+  0x00, 0x00, 0x7F, 0x80, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7F, 0x80, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+  0x00, 0x00, 0x7F, 0x80, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+  0x00, 0x00, 0x0F, 0x00, 0x31, 0x80, 0x20, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x43, 0x80, 0x40, 0x80, 0x40, 0x80, 0x20, 0x80, 0x30, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+  0x00, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+  0x00, 0x00, 0x3E, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+  0x00, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+  0x00, 0x00, 0x41, 0x00, 0x42, 0x00, 0x44, 0x00, 0x48, 0x00, 0x50, 0x00, 0x68, 0x00, 0x48, 0x00, 0x44, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+  0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+  0x00, 0x00, 0x61, 0x80, 0x61, 0x80, 0x73, 0x80, 0x52, 0x80, 0x52, 0x80, 0x4C, 0x80, 0x4C, 0x80, 0x4C, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+  0x00, 0x00, 0x60, 0x80, 0x60, 0x80, 0x50, 0x80, 0x50, 0x80, 0x48, 0x80, 0x48, 0x80, 0x44, 0x80, 0x44, 0x80, 0x42, 0x80, 0x42, 0x80, 0x41, 0x80, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+  0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x61, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x61, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+  0x00, 0x00, 0x7E, 0x00, 0x41, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+  0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x61, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x61, 0x80, 0x21, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Q'
+  0x00, 0x00, 0x7E, 0x00, 0x41, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x41, 0x80, 0x7E, 0x00, 0x41, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+  0x00, 0x00, 0x1E, 0x00, 0x23, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x00, 0x80, 0x40, 0x80, 0x61, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+  0x00, 0x00, 0xFF, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+  0x00, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+  0x00, 0x00, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+  0x00, 0x00, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x4C, 0x80, 0x4C, 0x80, 0x4C, 0x80, 0x4C, 0x80, 0x52, 0x80, 0x52, 0x80, 0x52, 0x80, 0x21, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+  0x00, 0x00, 0x40, 0x80, 0x21, 0x00, 0x21, 0x00, 0x12, 0x00, 0x12, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x12, 0x00, 0x21, 0x00, 0x21, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+  0x00, 0x00, 0x80, 0x80, 0x41, 0x00, 0x22, 0x00, 0x22, 0x00, 0x14, 0x00, 0x14, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+  0x00, 0x00, 0x0E, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,  // '['
+  0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'backslash'
+  0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,  // ']'
+  0x00, 0x00, 0x0E, 0x00, 0x1B, 0x00, 0x31, 0x80, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,  // '_'
+  0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x21, 0x80, 0x00, 0x80, 0x1F, 0x80, 0x60, 0x80, 0x40, 0x80, 0x41, 0x80, 0x63, 0x80, 0x3E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+  0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x5E, 0x00, 0x61, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x61, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x1E, 0x80, 0x21, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x80, 0x1E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x00, 0x40, 0x00, 0x20, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+  0x00, 0x00, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x21, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x80, 0x1E, 0x80, 0x00, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00,  // 'g'
+  0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x5F, 0x00, 0x61, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+  0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+  0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00,  // 'j'
+  0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x42, 0x00, 0x44, 0x00, 0x48, 0x00, 0x50, 0x00, 0x68, 0x00, 0x44, 0x00, 0x42, 0x00, 0x41, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+  0x00, 0x00, 0x78, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x61, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x61, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x61, 0x00, 0x5E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,  // 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x21, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x80, 0x1E, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,  // 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x18, 0x80, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x60, 0x80, 0x40, 0x00, 0x60, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x00, 0x80, 0x41, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x7E, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x61, 0x80, 0x3E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x80, 0x40, 0x4C, 0x80, 0x4C, 0x80, 0x54, 0x80, 0x52, 0x80, 0x52, 0x80, 0x21, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x80, 0x21, 0x00, 0x12, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x21, 0x00, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x12, 0x00, 0x12, 0x00, 0x0A, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x08, 0x00, 0x38, 0x00, 0x00, 0x00,  // 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x30, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00,  // '{'
+  0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,  // '|'
+  0x00, 0x00, 0x30, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x06, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00,  // '}'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x80, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+};
+
+static constexpr FontAtlas font_large = {
+  0x20, 0x7E, 10, 17, 1, 2, font_large_bitmap
+};
+
+// 10x17 cells, 4bpp, 5 bytes per row
+static constexpr uint8_t font_large_aa_bitmap[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0xF0, 0x00, 0x00, 0x5F, 0x05, 0xF0, 0x00, 0x00, 0x5F, 0x05, 0xF0, 0x00, 0x00, 0x5F, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0D, 0x60, 0x00, 0x05, 0xE0, 0x2F, 0x10, 0x00, 0x09, 0xA0, 0x6D, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x1F, 0x20, 0xF4, 0x00, 0x00, 0x5E, 0x02, 0xF1, 0x00, 0x00, 0x8B, 0x06, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x01, 0xF2, 0x0E, 0x50, 0x00, 0x06, 0xD0, 0x3F, 0x00, 0x00, 0x0A, 0x90, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xB3, 0x00, 0x02, 0xF7, 0x67, 0x4B, 0x00, 0x07, 0xF0, 0x66, 0x00, 0x00, 0x05, 0xF2, 0x66, 0x00, 0x00, 0x00, 0xBF, 0xDA, 0x30, 0x00, 0x00, 0x04, 0xAE, 0xFC, 0x00, 0x00, 0x00, 0x66, 0x2F, 0x80, 0x00, 0x00, 0x66, 0x0D, 0xA0, 0x07, 0x83, 0x66, 0x5F, 0x40, 0x00, 0x7C, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '$'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x30, 0x00, 0x00, 0x7B, 0x14, 0xE0, 0x00, 0x00, 0xB5, 0x00, 0xD3, 0x00, 0x00, 0x7B, 0x14, 0xE0, 0x00, 0x30, 0x09, 0xFD, 0x40, 0x4C, 0xA0, 0x00, 0x00, 0x4C, 0x92, 0x00, 0x00, 0x5C, 0x91, 0x00, 0x00, 0x2C, 0x91, 0x08, 0xED, 0x50, 0x01, 0x00, 0x5C, 0x13, 0xE1, 0x00, 0x00, 0x97, 0x00, 0xB5, 0x00, 0x00, 0x5C, 0x13, 0xE2, 0x00, 0x00, 0x08, 0xEE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xD0, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x06, 0xFD, 0xD0, 0x00, 0x00, 0x2F, 0x62, 0xF9, 0x00, 0xE5, 0x7E, 0x00, 0x6F, 0x40, 0xF4, 0x8E, 0x00, 0x0A, 0xE3, 0xF1, 0x5F, 0x20, 0x00, 0xEF, 0xA0, 0x0C, 0xD4, 0x03, 0xCF, 0x70, 0x00, 0x9E, 0xFD, 0x78, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x00, 0x09, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '('
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ')'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x06, 0x91, 0xA4, 0x4C, 0x10, 0x00, 0x3A, 0xEC, 0x81, 0x00, 0x00, 0x3A, 0xEC, 0x81, 0x00, 0x06, 0x91, 0xA4, 0x4C, 0x10, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ','
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x80, 0x00, 0x00, 0xEA, 0x13, 0xE9, 0x00, 0x07, 0xF1, 0x00, 0x7F, 0x10, 0x0B, 0xD0, 0x00, 0x2F, 0x50, 0x0D, 0xB0, 0x00, 0x0F, 0x80, 0x0E, 0xA1, 0xE9, 0x0F, 0x90, 0x0E, 0xA1, 0xE9, 0x0F, 0x90, 0x0D, 0xB0, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x00, 0x2F, 0x50, 0x07, 0xF1, 0x00, 0x7F, 0x10, 0x00, 0xEA, 0x13, 0xE9, 0x00, 0x00, 0x2B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0x20, 0x00, 0x01, 0xC6, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xFD, 0x60, 0x00, 0x0B, 0xC3, 0x04, 0xF9, 0x00, 0x07, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0x00, 0x00, 0x00, 0xCE, 0x20, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7D, 0xFD, 0x70, 0x00, 0x07, 0x72, 0x03, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x04, 0xEA, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x04, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x0B, 0x51, 0x04, 0xED, 0x00, 0x03, 0xAD, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x7E, 0xF5, 0x00, 0x00, 0x02, 0xF7, 0xF5, 0x00, 0x00, 0x0B, 0x94, 0xF5, 0x00, 0x00, 0x5F, 0x14, 0xF5, 0x00, 0x00, 0xE7, 0x04, 0xF5, 0x00, 0x09, 0xE0, 0x04, 0xF5, 0x00, 0x2F, 0x50, 0x04, 0xF5, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xFE, 0xFD, 0x70, 0x00, 0x05, 0x61, 0x17, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x0A, 0x51, 0x16, 0xF9, 0x00, 0x03, 0xBE, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEF, 0xC2, 0x00, 0x00, 0xBC, 0x30, 0x38, 0x00, 0x05, 0xF1, 0x00, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0x98, 0xEF, 0xB2, 0x00, 0x0E, 0xFA, 0x12, 0xCE, 0x00, 0x0E, 0xF1, 0x00, 0x2F, 0x50, 0x0E, 0xD0, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0x07, 0xF1, 0x00, 0x2F, 0x50, 0x01, 0xEA, 0x11, 0xBD, 0x00, 0x00, 0x2B, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x09, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFE, 0xA2, 0x00, 0x04, 0xF8, 0x02, 0xCD, 0x00, 0x09, 0xF0, 0x00, 0x5F, 0x40, 0x09, 0xF0, 0x00, 0x4F, 0x30, 0x02, 0xE7, 0x02, 0xCB, 0x00, 0x00, 0x4E, 0xFF, 0xC1, 0x00, 0x04, 0xF7, 0x02, 0xBD, 0x00, 0x0C, 0xC0, 0x00, 0x2F, 0x60, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0D, 0xC0, 0x00, 0x2F, 0x70, 0x06, 0xF7, 0x02, 0xBF, 0x10, 0x00, 0x5C, 0xFE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFE, 0x80, 0x00, 0x05, 0xF6, 0x04, 0xE9, 0x00, 0x0C, 0xC0, 0x00, 0x7F, 0x10, 0x0E, 0x90, 0x00, 0x3F, 0x50, 0x0E, 0x90, 0x00, 0x3F, 0x70, 0x0C, 0xC0, 0x00, 0x7F, 0x80, 0x05, 0xF6, 0x03, 0xEF, 0x80, 0x00, 0x6D, 0xFD, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02, 0x81, 0x06, 0xF5, 0x00, 0x00, 0x7D, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ';'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x39, 0xFF, 0x90, 0x00, 0x6C, 0xFC, 0x60, 0x00, 0x3F, 0xE8, 0x20, 0x00, 0x00, 0x3F, 0xE8, 0x20, 0x00, 0x00, 0x00, 0x6C, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x39, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x28, 0xEF, 0xA3, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xC0, 0x00, 0x00, 0x04, 0xAF, 0xC0, 0x00, 0x28, 0xEF, 0xA3, 0x00, 0x2C, 0xFD, 0x71, 0x00, 0x00, 0x4A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xEE, 0xA1, 0x00, 0x01, 0xB3, 0x03, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0xD7, 0x00, 0x01, 0xDA, 0x20, 0x3C, 0x90, 0x0B, 0xA0, 0x00, 0x02, 0xF0, 0x2F, 0x10, 0x5E, 0xE8, 0xF2, 0x7A, 0x02, 0xF5, 0x1B, 0xF3, 0xA7, 0x08, 0xA0, 0x02, 0xF3, 0xC6, 0x0B, 0x70, 0x00, 0xF3, 0xB6, 0x0B, 0x70, 0x00, 0xF3, 0xA8, 0x08, 0xA0, 0x02, 0xF3, 0x7B, 0x02, 0xF5, 0x1A, 0xF3, 0x1F, 0x20, 0x5E, 0xE8, 0xE3, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x40, 0x00, 0x00, 0x00, 0x05, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x30, 0x00, 0x00, 0x0E, 0x9E, 0x80, 0x00, 0x00, 0x2F, 0x4A, 0xD0, 0x00, 0x00, 0x7F, 0x06, 0xF1, 0x00, 0x00, 0xCC, 0x02, 0xF6, 0x00, 0x01, 0xF8, 0x00, 0xEB, 0x00, 0x05, 0xF4, 0x00, 0xAF, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x4F, 0x50, 0x00, 0x0B, 0xE0, 0x8F, 0x10, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xB3, 0x00, 0x0B, 0xE0, 0x01, 0xAE, 0x10, 0x0B, 0xE0, 0x00, 0x2F, 0x60, 0x0B, 0xE0, 0x00, 0x3F, 0x60, 0x0B, 0xE0, 0x01, 0xBE, 0x10, 0x0B, 0xFF, 0xFF, 0xE3, 0x00, 0x0B, 0xE0, 0x01, 0x9F, 0x30, 0x0B, 0xE0, 0x00, 0x0E, 0xB0, 0x0B, 0xE0, 0x00, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0x0D, 0xC0, 0x0B, 0xE0, 0x01, 0x8F, 0x60, 0x0B, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCF, 0xD8, 0x00, 0x00, 0x8F, 0x50, 0x2C, 0x60, 0x03, 0xF6, 0x00, 0x01, 0x40, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x01, 0x40, 0x00, 0x9F, 0x50, 0x2C, 0x60, 0x00, 0x06, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xEB, 0x30, 0x00, 0x0E, 0xA0, 0x28, 0xF5, 0x00, 0x0E, 0xA0, 0x00, 0x9F, 0x00, 0x0E, 0xA0, 0x00, 0x4F, 0x50, 0x0E, 0xA0, 0x00, 0x1F, 0x80, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x1F, 0x80, 0x0E, 0xA0, 0x00, 0x4F, 0x50, 0x0E, 0xA0, 0x00, 0x9F, 0x00, 0x0E, 0xA0, 0x18, 0xF5, 0x00, 0x0E, 0xFF, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x70, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x30, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xB0, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x30, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0xD6, 0x00, 0x00, 0xCD, 0x30, 0x4E, 0x30, 0x07, 0xF2, 0x00, 0x02, 0x30, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x09, 0xFF, 0xA0, 0x1F, 0x80, 0x00, 0x0E, 0xA0, 0x0E, 0xB0, 0x00, 0x0E, 0xA0, 0x08, 0xF1, 0x00, 0x0E, 0xA0, 0x00, 0xDC, 0x20, 0x3F, 0xA0, 0x00, 0x19, 0xEF, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xFF, 0xFF, 0xFF, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x0E, 0xA0, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x24, 0x00, 0x04, 0xF4, 0x00, 0x2F, 0x61, 0x2C, 0xE0, 0x00, 0x05, 0xCF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x0C, 0xD1, 0x0E, 0xA0, 0x00, 0xCE, 0x20, 0x0E, 0xA0, 0x0B, 0xF3, 0x00, 0x0E, 0xA0, 0xAF, 0x30, 0x00, 0x0E, 0xA9, 0xF4, 0x00, 0x00, 0x0E, 0xFF, 0xF4, 0x00, 0x00, 0x0E, 0xF6, 0xCE, 0x00, 0x00, 0x0E, 0xB0, 0x3F, 0x90, 0x00, 0x0E, 0xA0, 0x08, 0xF4, 0x00, 0x0E, 0xA0, 0x00, 0xDE, 0x00, 0x0E, 0xA0, 0x00, 0x4F, 0x90, 0x0E, 0xA0, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x5F, 0xF0, 0x5F, 0xF4, 0x00, 0xAF, 0xF0, 0x5F, 0xA9, 0x00, 0xFA, 0xF0, 0x5F, 0x5E, 0x04, 0xD8, 0xF0, 0x5F, 0x2E, 0x39, 0x88, 0xF0, 0x5F, 0x29, 0x8E, 0x38, 0xF0, 0x5F, 0x24, 0xFE, 0x08, 0xF0, 0x5F, 0x20, 0xE9, 0x08, 0xF0, 0x5F, 0x20, 0x00, 0x08, 0xF0, 0x5F, 0x20, 0x00, 0x08, 0xF0, 0x5F, 0x20, 0x00, 0x08, 0xF0, 0x5F, 0x20, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF4, 0x00, 0x0F, 0x80, 0x0E, 0xFB, 0x00, 0x0F, 0x80, 0x0E, 0xDF, 0x10, 0x0F, 0x80, 0x0E, 0x9D, 0x70, 0x0F, 0x80, 0x0E, 0x97, 0xE0, 0x0F, 0x80, 0x0E, 0x91, 0xF4, 0x0F, 0x80, 0x0E, 0x90, 0xAA, 0x0F, 0x80, 0x0E, 0x90, 0x4F, 0x1F, 0x80, 0x0E, 0x90, 0x0D, 0x7F, 0x80, 0x0E, 0x90, 0x07, 0xDF, 0x80, 0x0E, 0x90, 0x01, 0xFF, 0x80, 0x0E, 0x90, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFE, 0x90, 0x00, 0x02, 0xF9, 0x02, 0xDB, 0x00, 0x09, 0xF0, 0x00, 0x5F, 0x30, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0F, 0x90, 0x00, 0x0F, 0xA0, 0x0F, 0x90, 0x00, 0x0F, 0xB0, 0x0F, 0x90, 0x00, 0x0F, 0xB0, 0x0F, 0x90, 0x00, 0x0F, 0xA0, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x09, 0xF0, 0x00, 0x5F, 0x30, 0x02, 0xF9, 0x02, 0xDB, 0x00, 0x00, 0x3C, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xC5, 0x00, 0x07, 0xF2, 0x01, 0x9F, 0x60, 0x07, 0xF2, 0x00, 0x0E, 0xC0, 0x07, 0xF2, 0x00, 0x0C, 0xE0, 0x07, 0xF2, 0x00, 0x0E, 0xC0, 0x07, 0xF2, 0x01, 0x9F, 0x50, 0x07, 0xFF, 0xFE, 0xC5, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFE, 0x90, 0x00, 0x02, 0xF9, 0x02, 0xDB, 0x00, 0x09, 0xF0, 0x00, 0x5F, 0x30, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0F, 0x90, 0x00, 0x0F, 0xA0, 0x0F, 0x90, 0x00, 0x0F, 0xB0, 0x0F, 0x90, 0x00, 0x0F, 0xB0, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x09, 0xF0, 0x00, 0x5F, 0x30, 0x02, 0xF9, 0x02, 0xDC, 0x00, 0x00, 0x3C, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFD, 0x80, 0x00, 0x0E, 0xB0, 0x04, 0xFC, 0x00, 0x0E, 0xB0, 0x00, 0x8F, 0x30, 0x0E, 0xB0, 0x00, 0x5F, 0x50, 0x0E, 0xB0, 0x00, 0x7F, 0x30, 0x0E, 0xB0, 0x03, 0xEB, 0x00, 0x0E, 0xFF, 0xFF, 0x90, 0x00, 0x0E, 0xB0, 0x07, 0xF4, 0x00, 0x0E, 0xB0, 0x00, 0xBD, 0x00, 0x0E, 0xB0, 0x00, 0x3F, 0x60, 0x0E, 0xB0, 0x00, 0x0C, 0xE0, 0x0E, 0xB0, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xEE, 0xA3, 0x00, 0x05, 0xF7, 0x11, 0x9E, 0x00, 0x0C, 0xB0, 0x00, 0x06, 0x00, 0x0D, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xE2, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xC8, 0x30, 0x00, 0x00, 0x03, 0x8C, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x07, 0x00, 0x00, 0x1F, 0x70, 0x0C, 0xC3, 0x02, 0xBF, 0x20, 0x02, 0x9D, 0xFE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x0C, 0xB0, 0x00, 0x1F, 0x70, 0x0B, 0xD0, 0x00, 0x2F, 0x50, 0x05, 0xF7, 0x12, 0xBE, 0x00, 0x00, 0x4C, 0xFE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x09, 0xF0, 0x1F, 0x70, 0x00, 0x0D, 0xC0, 0x0D, 0xB0, 0x00, 0x1F, 0x70, 0x08, 0xF0, 0x00, 0x5F, 0x30, 0x04, 0xF3, 0x00, 0x9E, 0x00, 0x00, 0xF7, 0x00, 0xD9, 0x00, 0x00, 0xBB, 0x01, 0xF5, 0x00, 0x00, 0x6F, 0x06, 0xF1, 0x00, 0x00, 0x2F, 0x4A, 0xC0, 0x00, 0x00, 0x0D, 0x8E, 0x70, 0x00, 0x00, 0x09, 0xEF, 0x30, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xF9, 0xCB, 0x00, 0x00, 0x01, 0xF6, 0xAD, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x01, 0xFB, 0x04, 0xF2, 0x5F, 0x05, 0xFE, 0x06, 0xF0, 0x3F, 0x28, 0xAF, 0x28, 0xD0, 0x0F, 0x4B, 0x6C, 0x5A, 0xB0, 0x0E, 0x6E, 0x39, 0x8C, 0x80, 0x0C, 0xAF, 0x05, 0xBE, 0x60, 0x09, 0xEC, 0x02, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0xEF, 0x10, 0x05, 0xF5, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x0B, 0xE0, 0x06, 0xF3, 0x00, 0x5F, 0x40, 0x00, 0xDC, 0x00, 0xDB, 0x00, 0x00, 0x3F, 0x57, 0xF1, 0x00, 0x00, 0x0A, 0xEF, 0x70, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x8B, 0xD0, 0x00, 0x00, 0xBE, 0x02, 0xF6, 0x00, 0x05, 0xF5, 0x00, 0x9E, 0x10, 0x0E, 0xB0, 0x00, 0x1F, 0x90, 0x8F, 0x20, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x09, 0xF1, 0x0D, 0xC0, 0x00, 0x2F, 0x70, 0x04, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0xBD, 0x03, 0xF5, 0x00, 0x00, 0x2F, 0x6C, 0xC0, 0x00, 0x00, 0x09, 0xFF, 0x30, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x00, 0x00, 0x00, 0x6F, 0x70, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '['
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'backslash'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ']'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFD, 0x10, 0x00, 0x00, 0x3F, 0x8C, 0xC0, 0x00, 0x02, 0xE7, 0x00, 0xCB, 0x00, 0x1E, 0x70, 0x00, 0x0C, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,  // '_'
+  0x00, 0x6F, 0x20, 0x00, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFE, 0xA2, 0x00, 0x04, 0x92, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x6D, 0xFF, 0xFF, 0x40, 0x07, 0xF5, 0x10, 0x3F, 0x40, 0x0D, 0x90, 0x00, 0x4F, 0x40, 0x0E, 0x80, 0x00, 0x9F, 0x40, 0x09, 0xE3, 0x16, 0xEF, 0x40, 0x00, 0x9E, 0xFB, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xEF, 0xC2, 0x00, 0x07, 0xFC, 0x21, 0xBE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0x60, 0x07, 0xF0, 0x00, 0x0E, 0x90, 0x07, 0xF0, 0x00, 0x0D, 0xA0, 0x07, 0xF0, 0x00, 0x0E, 0x90, 0x07, 0xF4, 0x00, 0x2F, 0x50, 0x07, 0xFC, 0x21, 0xBE, 0x00, 0x07, 0xF6, 0xEF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xD8, 0x00, 0x00, 0x8F, 0x61, 0x16, 0x40, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x61, 0x16, 0x40, 0x00, 0x06, 0xDF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x6D, 0xFC, 0x7F, 0x20, 0x04, 0xF7, 0x15, 0xFF, 0x20, 0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x0E, 0x90, 0x00, 0x6F, 0x20, 0x0F, 0x80, 0x00, 0x5F, 0x20, 0x0E, 0x90, 0x00, 0x6F, 0x20, 0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x04, 0xF6, 0x05, 0xFF, 0x20, 0x00, 0x6D, 0xFC, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xB2, 0x00, 0x02, 0xFA, 0x11, 0xAD, 0x00, 0x0A, 0xE0, 0x00, 0x0F, 0x60, 0x0E, 0x90, 0x00, 0x0D, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x20, 0x39, 0x50, 0x00, 0x2A, 0xEF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x50, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFC, 0x7F, 0x20, 0x03, 0xF7, 0x14, 0xFF, 0x20, 0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x0E, 0x90, 0x00, 0x6F, 0x20, 0x0F, 0x80, 0x00, 0x5F, 0x20, 0x0E, 0x90, 0x00, 0x6F, 0x20, 0x0B, 0xC0, 0x00, 0x9F, 0x20, 0x04, 0xF7, 0x14, 0xEF, 0x20, 0x00, 0x6D, 0xFC, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0xA3, 0x03, 0xD9, 0x00, 0x00, 0x5C, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'g'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xDF, 0xC3, 0x00, 0x07, 0xFB, 0x21, 0xCD, 0x00, 0x07, 0xF2, 0x00, 0x5F, 0x10, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x08, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'j'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x6F, 0x50, 0x02, 0xF5, 0x06, 0xF5, 0x00, 0x02, 0xF5, 0x6F, 0x50, 0x00, 0x02, 0xFB, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0x30, 0x00, 0x02, 0xF6, 0x0C, 0xD0, 0x00, 0x02, 0xF5, 0x02, 0xF9, 0x00, 0x02, 0xF5, 0x00, 0x6F, 0x50, 0x02, 0xF5, 0x00, 0x0B, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAE, 0xC6, 0xED, 0x30, 0x2F, 0x72, 0xFC, 0x1B, 0xA0, 0x2F, 0x30, 0xD9, 0x07, 0xD0, 0x2F, 0x20, 0xC8, 0x07, 0xD0, 0x2F, 0x20, 0xC8, 0x07, 0xE0, 0x2F, 0x20, 0xC8, 0x07, 0xE0, 0x2F, 0x20, 0xC8, 0x07, 0xE0, 0x2F, 0x20, 0xC8, 0x07, 0xE0, 0x2F, 0x20, 0xC8, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xDF, 0xC3, 0x00, 0x07, 0xFB, 0x21, 0xCD, 0x00, 0x07, 0xF2, 0x00, 0x5F, 0x10, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFE, 0xA1, 0x00, 0x03, 0xF9, 0x12, 0xDC, 0x00, 0x0A, 0xE0, 0x00, 0x4F, 0x40, 0x0D, 0xA0, 0x00, 0x0F, 0x70, 0x0E, 0x90, 0x00, 0x0F, 0x80, 0x0D, 0xA0, 0x00, 0x0F, 0x70, 0x0A, 0xE0, 0x00, 0x4F, 0x40, 0x03, 0xF9, 0x12, 0xDC, 0x00, 0x00, 0x4C, 0xFE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0xEF, 0xB2, 0x00, 0x08, 0xFC, 0x21, 0xBD, 0x00, 0x08, 0xF3, 0x00, 0x2F, 0x50, 0x08, 0xF0, 0x00, 0x0E, 0x80, 0x08, 0xF0, 0x00, 0x0D, 0x90, 0x08, 0xF0, 0x00, 0x0E, 0x80, 0x08, 0xF3, 0x00, 0x2F, 0x50, 0x08, 0xFC, 0x21, 0xBD, 0x00, 0x08, 0xF7, 0xEF, 0xB2, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFD, 0x7F, 0x40, 0x02, 0xF8, 0x14, 0xEF, 0x40, 0x09, 0xE0, 0x00, 0x8F, 0x40, 0x0C, 0xA0, 0x00, 0x4F, 0x40, 0x0E, 0x90, 0x00, 0x3F, 0x40, 0x0C, 0xA0, 0x00, 0x4F, 0x40, 0x09, 0xE0, 0x00, 0x8F, 0x40, 0x02, 0xF8, 0x14, 0xEF, 0x40, 0x00, 0x5D, 0xFD, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'q'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x48, 0xEE, 0x70, 0x00, 0x2F, 0xC8, 0x11, 0x80, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFE, 0xA1, 0x00, 0x01, 0xF9, 0x11, 0x57, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x05, 0xED, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x93, 0x02, 0xDB, 0x00, 0x00, 0x6C, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x3F, 0x30, 0x07, 0xF0, 0x00, 0x4F, 0x30, 0x06, 0xF1, 0x00, 0x7F, 0x30, 0x02, 0xF8, 0x03, 0xDF, 0x30, 0x00, 0x6E, 0xFB, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x0D, 0xA0, 0x0B, 0xC0, 0x00, 0x2F, 0x50, 0x05, 0xF1, 0x00, 0x7F, 0x00, 0x00, 0xF7, 0x00, 0xDA, 0x00, 0x00, 0xAC, 0x02, 0xF4, 0x00, 0x00, 0x5F, 0x27, 0xE0, 0x00, 0x00, 0x0F, 0x7D, 0x90, 0x00, 0x00, 0x0A, 0xEF, 0x40, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xE8, 0xAB, 0x00, 0x00, 0x01, 0xF4, 0x6E, 0x00, 0x00, 0x04, 0xF1, 0x3F, 0x20, 0xE9, 0x08, 0xD0, 0x0F, 0x53, 0xED, 0x0B, 0x90, 0x0C, 0x88, 0x7D, 0x2E, 0x60, 0x08, 0xCC, 0x28, 0x9F, 0x20, 0x04, 0xFD, 0x03, 0xFE, 0x00, 0x01, 0xF9, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x50, 0x01, 0xE9, 0x01, 0xEA, 0x00, 0x00, 0x4F, 0x4A, 0xD0, 0x00, 0x00, 0x08, 0xFF, 0x30, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0C, 0xCF, 0x70, 0x00, 0x00, 0x9E, 0x16, 0xF3, 0x00, 0x04, 0xF5, 0x00, 0xBE, 0x10, 0x1E, 0x90, 0x00, 0x1E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x09, 0xE0, 0x00, 0x1F, 0x60, 0x03, 0xF4, 0x00, 0x6F, 0x10, 0x00, 0xDA, 0x00, 0xCA, 0x00, 0x00, 0x7F, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x58, 0xE0, 0x00, 0x00, 0x0A, 0xBD, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x01, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x09, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'y'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFE, 0x00, 0x00, 0x00, 0xBD, 0x20, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x00, 0x2C, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '{'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00,  // '|'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x20, 0x00, 0x00, 0x00, 0x1D, 0xFE, 0x00, 0x00, 0x00, 0xAD, 0x20, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x04, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '}'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEF, 0xB4, 0x02, 0xA0, 0x46, 0x11, 0x5B, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+};
+
+static constexpr FontAtlas font_large_aa = {
+  0x20, 0x7E, 10, 17, 4, 5, font_large_aa_bitmap
+};
+
+#endif
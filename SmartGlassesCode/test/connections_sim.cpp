@@ -0,0 +1,263 @@
+// Host simulation of the notify scheduler with several virtual centrals.
+//
+// connections.cpp is built as-is; transportNotify() is implemented here by a
+// simple link model. Each central has a small stack buffer that drains a fixed
+// number of packets per loop() round; when it fills up the stack raises a
+// congestion event, as ESP_GATTS_CONGEST_EVT does on the device.
+//
+// Scenario: one central pulls a large image at the default MTU, another only
+// sends 'S' status requests, and a third pulls a small image. All of them poll
+// status; requests arrive between loop() rounds and replies are timed until
+// they are on air. The simulation reports status-reply latency per central.
+#include "connections.h"
+#include <deque>
+#include <map>
+#include <string>
+
+unsigned long stubMillis = 0;
+
+#define SIM_ROUND_MS 120            // loop(): delay(20) after servicing + delay(100)
+#define SIM_PACKET_MS 15            // Air time per packet on one link
+#define SIM_LINK_BUFFER 8           // Packets the stack buffers per link
+#define SIM_REQUEST_OFFSET_MS 60    // 'S' requests land mid-round, between services
+#define SIM_STATUS_PERIOD 8         // Rounds between 'S' requests (~1 s)
+
+static int failures = 0;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+      failures++;                                                     \
+    }                                                                 \
+  } while (0)
+
+struct Packet {
+  NotifyChannel channel;
+  std::string payload;
+};
+
+struct VirtualCentral {
+  uint16_t connId;
+  std::deque<Packet> link;              // Accepted by the stack, not yet on air
+  std::map<std::string, unsigned long> statusSentAt;
+  unsigned long statusReplies = 0;
+  unsigned long latencyTotal = 0;
+  unsigned long latencyMax = 0;
+  size_t imageBytes = 0;
+  size_t imageExpected = 0;
+  unsigned long imageDoneAt = 0;
+};
+
+static VirtualCentral centrals[MAX_CONNECTIONS];
+
+static VirtualCentral* centralFor(uint16_t connId) {
+  for (VirtualCentral& c : centrals) {
+    if (c.connId == connId) return &c;
+  }
+  return nullptr;
+}
+
+bool transportNotify(uint16_t connId, NotifyChannel channel, const uint8_t* data, size_t len) {
+  VirtualCentral* central = centralFor(connId);
+  if (!central || central->link.size() >= SIM_LINK_BUFFER) return false;
+  central->link.push_back({channel, std::string((const char*)data, len)});
+  if (central->link.size() >= SIM_LINK_BUFFER) setCongested(connId, true);
+  return true;
+}
+
+// Air time: each link sends one packet per SIM_PACKET_MS slot of the round
+static void drainLinks(unsigned long roundStart) {
+  for (VirtualCentral& c : centrals) {
+    for (int slot = 1; slot <= SIM_ROUND_MS / SIM_PACKET_MS && !c.link.empty(); slot++) {
+      unsigned long onAir = roundStart + slot * SIM_PACKET_MS;
+      Packet p = c.link.front();
+      c.link.pop_front();
+      if (p.channel == CHANNEL_STATUS) {
+        auto sent = c.statusSentAt.find(p.payload);
+        if (sent != c.statusSentAt.end()) {
+          unsigned long latency = onAir - sent->second;
+          c.latencyTotal += latency;
+          if (latency > c.latencyMax) c.latencyMax = latency;
+          c.statusReplies++;
+          c.statusSentAt.erase(sent);
+        }
+      } else if (p.channel == CHANNEL_IMAGE) {
+        c.imageBytes += p.payload.size();
+        if (c.imageBytes >= c.imageExpected && !c.imageDoneAt) c.imageDoneAt = onAir;
+      }
+    }
+    if (c.link.size() < SIM_LINK_BUFFER / 2) setCongested(c.connId, false);
+  }
+}
+
+static ConnectionState* connect(uint16_t connId, uint16_t mtu, bool image, bool status) {
+  centrals[connId].connId = connId;
+  ConnectionState* conn = addConnection(connId);
+  setConnectionMtu(connId, mtu);
+  setSubscription(connId, CHANNEL_IMAGE, image);
+  setSubscription(connId, CHANNEL_STATUS, status);
+  return conn;
+}
+
+static void startImage(ConnectionState* conn, size_t size) {
+  uint8_t* buffer = (uint8_t*)malloc(size);
+  memset(buffer, 0xAB, size);
+  centrals[conn->connId].imageExpected = size;
+  beginImageTransfer(conn, buffer, size);
+}
+
+static bool imagesPending() {
+  for (const ConnectionState& conn : connections) {
+    if (conn.active && conn.imageBuffer != NULL) return true;
+  }
+  return false;
+}
+
+// 'S' request arriving at time `at`; the reply carries a sequence number so its
+// latency can be measured
+static void requestStatus(ConnectionState* conn, int seq, unsigned long at) {
+  std::string payload = "Ready " + std::to_string(seq);
+  if (queueNotify(conn, CHANNEL_STATUS, String(payload))) {
+    centrals[conn->connId].statusSentAt[payload] = at;
+  }
+}
+
+static void testMixedTraffic() {
+  ConnectionState* bulk = connect(0, DEFAULT_ATT_MTU, true, true);  // 20 KB image at MTU 23
+  ConnectionState* poller = connect(1, 185, false, true);           // Status only
+  ConnectionState* mixed = connect(2, 247, true, true);             // Small image plus status
+
+  startImage(bulk, 20000);
+  startImage(mixed, 6000);
+
+  int seq = 0;
+  int round = 0;
+  while (imagesPending() || round < 40) {
+    // Requests that arrived since the previous round
+    unsigned long requestAt = stubMillis - SIM_ROUND_MS + SIM_REQUEST_OFFSET_MS;
+    if (round % SIM_STATUS_PERIOD == 1) requestStatus(poller, seq++, requestAt);
+    if (round % SIM_STATUS_PERIOD == 3) requestStatus(bulk, seq++, requestAt);
+    if (round % SIM_STATUS_PERIOD == 5) requestStatus(mixed, seq++, requestAt);
+
+    serviceNotifications();
+    drainLinks(stubMillis);
+    stubMillis += SIM_ROUND_MS;
+    round++;
+  }
+
+  printf("mixed traffic, %d rounds of %d ms:\n", round, SIM_ROUND_MS);
+  const char* names[] = {"bulk image", "status poller", "image + status"};
+  for (int i = 0; i < MAX_CONNECTIONS; i++) {
+    VirtualCentral& c = centrals[i];
+    printf("  central %d (%-14s): %3lu status replies, latency avg %5.1f ms max %4lu ms",
+           i, names[i], c.statusReplies,
+           c.statusReplies ? (double)c.latencyTotal / c.statusReplies : 0.0, c.latencyMax);
+    if (c.imageExpected) printf(", image %zu B done at %lu ms", c.imageBytes, c.imageDoneAt);
+    printf("\n");
+  }
+
+  // Every reply goes out in the first air slot after the next round, ahead of
+  // that central's own image chunk and regardless of the other transfers
+  for (VirtualCentral& c : centrals) {
+    CHECK(c.statusSentAt.empty());
+    CHECK(c.statusReplies > 0);
+    CHECK(c.latencyMax <= SIM_ROUND_MS - SIM_REQUEST_OFFSET_MS + SIM_PACKET_MS);
+  }
+
+  // Both images arrive, and the small one is not held back by the large one:
+  // one chunk of mtu - 3 bytes per round
+  CHECK(centrals[0].imageBytes == 20000);
+  CHECK(centrals[2].imageBytes == 6000);
+  unsigned long smallImageRounds = (6000 + chunkSize - 1) / chunkSize;
+  CHECK(centrals[2].imageDoneAt <= (smallImageRounds + 1) * SIM_ROUND_MS);
+  CHECK(centrals[2].imageDoneAt < centrals[0].imageDoneAt);
+
+  removeConnection(0);
+  removeConnection(1);
+  removeConnection(2);
+  CHECK(connectionCount == 0);
+}
+
+// Nothing goes to a congested link; queued replies follow once it clears
+static void testCongestionHoldsTraffic() {
+  for (VirtualCentral& c : centrals) c = VirtualCentral();
+  ConnectionState* conn = connect(0, DEFAULT_ATT_MTU, true, true);
+  setCongested(0, true);
+  requestStatus(conn, 1000, stubMillis);
+  serviceNotifications();
+  CHECK(centrals[0].link.empty());
+
+  setCongested(0, false);
+  serviceNotifications();
+  CHECK(centrals[0].link.size() == 1);
+  removeConnection(0);
+}
+
+// Queued text is cut to what one notification can carry at the link's MTU
+static void testPayloadFitsMtu() {
+  for (VirtualCentral& c : centrals) c = VirtualCentral();
+  ConnectionState* conn = connect(0, DEFAULT_ATT_MTU, false, true);
+  String longText("Camera Reset Complete - sensor reinitialised");
+  CHECK(queueNotify(conn, CHANNEL_STATUS, longText));
+  serviceNotifications();
+  CHECK(centrals[0].link.size() == 1);
+  CHECK(centrals[0].link.front().payload.size() == DEFAULT_ATT_MTU - 3);
+  centrals[0].link.clear();
+
+  setConnectionMtu(0, 185);
+  CHECK(queueNotify(conn, CHANNEL_STATUS, longText));
+  serviceNotifications();
+  CHECK(centrals[0].link.size() == 1);
+  CHECK(centrals[0].link.front().payload.size() == longText.length());
+  removeConnection(0);
+}
+
+// A central that asked for a capture but never subscribes does not pin the
+// image: it is freed after IMAGE_SUBSCRIBE_TIMEOUT and loop() stops waiting
+static void testUnsubscribedImageExpires() {
+  for (VirtualCentral& c : centrals) c = VirtualCentral();
+  ConnectionState* conn = connect(0, DEFAULT_ATT_MTU, false, true);
+  startImage(conn, 4000);
+
+  stubMillis += IMAGE_SUBSCRIBE_TIMEOUT - 1;
+  CHECK(!serviceNotifications());
+  CHECK(conn->imageBuffer != NULL);
+
+  stubMillis += 1;
+  CHECK(!serviceNotifications());
+  CHECK(conn->imageBuffer == NULL);
+  CHECK(centrals[0].link.empty());
+  removeConnection(0);
+}
+
+// Subscribing late, within the timeout, still gets the image
+static void testLateSubscriptionSendsImage() {
+  for (VirtualCentral& c : centrals) c = VirtualCentral();
+  ConnectionState* conn = connect(0, DEFAULT_ATT_MTU, false, true);
+  startImage(conn, 40);
+
+  stubMillis += IMAGE_SUBSCRIBE_TIMEOUT / 2;
+  CHECK(!serviceNotifications());
+  setSubscription(0, CHANNEL_IMAGE, true);
+  CHECK(serviceNotifications());
+  CHECK(serviceNotifications());
+  CHECK(conn->imageBuffer == NULL);
+  CHECK(centrals[0].link.size() == 2);
+  removeConnection(0);
+}
+
+int main() {
+  testMixedTraffic();
+  testCongestionHoldsTraffic();
+  testPayloadFitsMtu();
+  testUnsubscribedImageExpires();
+  testLateSubscriptionSendsImage();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("connections_sim passed\n");
+  return 0;
+}
@@ -0,0 +1,190 @@
+// Host test: the retained connection status screen follows the text size
+// display settings and word-wraps its message like showTemporaryMessage, long
+// message titles wrap instead of being clipped, and screen changes queued from
+// BLE callbacks only happen when loop() processes them.
+#include "display.h"
+
+unsigned long stubMillis = 0;
+extern Adafruit_ST7735 tft;
+extern bool isShowingTime;
+
+static int failures = 0;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+      failures++;                                                     \
+    }                                                                 \
+  } while (0)
+
+// Lit pixels in rows [top, top + rows)
+static long litPixels(int top, int rows) {
+  long lit = 0;
+  for (int y = top; y < top + rows && y < tft.height(); y++) {
+    for (int x = 0; x < tft.width(); x++) {
+      if (tft.pixelAt(x, y) != ST7735_BLACK) lit++;
+    }
+  }
+  return lit;
+}
+
+static void setTextSizes(const char* title, const char* message) {
+  displaySettings.titleSize = title;
+  displaySettings.messageSize = message;
+  applyDisplaySettings();
+}
+
+// Top of message line `line` for the current settings
+static int messageLineY(int line) {
+  const FontAtlas& titleFont = fontForTextSize(getTitleTextSize());
+  const FontAtlas& messageFont = fontForTextSize(getMessageTextSize());
+  return TITLE_TOP_MARGIN + titleFont.height + TITLE_LINE_SPACING + LINE_MESSAGE_SPACING +
+         line * messageFont.height;
+}
+
+static void testLargeSettingsWrapMessage() {
+  setTextSizes("large", "large");
+  clearDisplay();
+  showConnectionStatus(true);
+
+  // "Device connected successfully" needs two 16-cell lines at text size 2
+  const FontAtlas& messageFont = fontForTextSize(2);
+  CHECK(litPixels(messageLineY(0), messageFont.height) > 0);
+  CHECK(litPixels(messageLineY(1), messageFont.height) > 0);
+}
+
+static void testSmallSettingsUseSmallFont() {
+  setTextSizes("small", "small");
+  clearDisplay();
+  showConnectionStatus(true);
+
+  // The title band ends where the small font does, the divider follows
+  const FontAtlas& titleFont = fontForTextSize(1);
+  int dividerY = TITLE_TOP_MARGIN + titleFont.height + TITLE_LINE_SPACING;
+  CHECK(litPixels(dividerY, 1) == tft.width());
+  CHECK(litPixels(TITLE_TOP_MARGIN + titleFont.height, TITLE_LINE_SPACING) == 0);
+}
+
+static void testSettingsChangeRelayoutsActiveScreen() {
+  setTextSizes("small", "small");
+  clearDisplay();
+  showConnectionStatus(false);
+
+  // Switching sizes while the status screen is up must not leave the old layout behind
+  setTextSizes("large", "large");
+  showConnectionStatus(false);
+  const FontAtlas& titleFont = fontForTextSize(2);
+  int dividerY = TITLE_TOP_MARGIN + titleFont.height + TITLE_LINE_SPACING;
+  int oldDividerY = TITLE_TOP_MARGIN + fontForTextSize(1).height + TITLE_LINE_SPACING;
+  CHECK(litPixels(dividerY, 1) == tft.width());
+  CHECK(litPixels(oldDividerY, 1) < tft.width());
+}
+
+static void testStatusChangeRepaintsOnlyWidgets() {
+  setTextSizes("medium", "medium");
+  clearDisplay();
+  showConnectionStatus(true);
+
+  tft.resetCounters();
+  showConnectionStatus(false);
+  printf("status change: %llu pixels repainted (full screen %d)\n",
+         (unsigned long long)tft.pixels, tft.width() * tft.height());
+  CHECK(tft.pixels < (uint64_t)tft.width() * tft.height() / 4);
+}
+
+// Long titles wrap onto a second line and push the divider and message down
+static void testLongTitleWraps() {
+  setTextSizes("large", "small");
+  showMessage("At Sofia Tech Park", "Building B");
+
+  const FontAtlas& titleFont = fontForTextSize(2);
+  int dividerY = TITLE_TOP_MARGIN + 2 * titleFont.height + TITLE_LINE_SPACING;
+  CHECK(litPixels(TITLE_TOP_MARGIN + titleFont.height, titleFont.height) > 0);
+  CHECK(litPixels(dividerY, 1) == tft.width());
+  CHECK(litPixels(dividerY + 1, LINE_MESSAGE_SPACING + fontForTextSize(1).height) > 0);
+}
+
+// A title that does not fit in TITLE_MAX_LINES ends in "..."
+static void testOverlongTitleShowsEllipsis() {
+  setTextSizes("large", "small");
+  showMessage("Quarterly planning meeting with the design team", "Room 4");
+
+  const FontAtlas& titleFont = fontForTextSize(2);
+  unsigned int cells = tft.width() / titleFont.advance;
+  int lastLineY = TITLE_TOP_MARGIN + (TITLE_MAX_LINES - 1) * titleFont.height;
+
+  // Find where the last line's text ends and compare those cells with "..."
+  int endX = 0;
+  for (int y = lastLineY; y < lastLineY + titleFont.height; y++) {
+    for (int x = 0; x < tft.width(); x++) {
+      if (tft.pixelAt(x, y) != ST7735_BLACK && x + 1 > endX) endX = x + 1;
+    }
+  }
+  int cellX = (endX + titleFont.advance - 1) / titleFont.advance * titleFont.advance - 3 * titleFont.advance;
+  CHECK(cellX > 0 && (unsigned int)cellX / titleFont.advance <= cells - 3);
+
+  Adafruit_SPITFT expected;
+  drawText(expected, cellX, lastLineY, "...", titleFont, ST7735_CYAN, ST7735_BLACK);
+  long mismatches = 0;
+  for (int y = lastLineY; y < lastLineY + titleFont.height; y++) {
+    for (int x = cellX; x < cellX + 3 * titleFont.advance; x++) {
+      if (tft.pixelAt(x, y) != expected.pixelAt(x, y)) mismatches++;
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+// BLE callbacks only queue screen changes; nothing is drawn and no setting
+// changes until loop() processes the queue, in order
+static void testQueuedRequestsWaitForLoop() {
+  setTextSizes("medium", "medium");
+  clearDisplay();
+
+  queueDisplaySettings("large", "large");
+  queueMessage("Display Settings", "Text size settings updated.");
+  queueTimeDisplay();
+  CHECK(litPixels(0, tft.height()) == 0);
+  CHECK(getTitleTextSize() == 1);
+
+  processDisplayQueue();
+  CHECK(getTitleTextSize() == 2);
+  CHECK(getMessageTextSize() == 2);
+  CHECK(isShowingTime);
+  CHECK(litPixels(0, tft.height()) > 0);
+}
+
+// A full queue drops the oldest request, so the latest screen change shows
+static void testFullQueueKeepsNewest() {
+  setTextSizes("medium", "medium");
+  clearDisplay();
+
+  queueTimeDisplay();
+  for (int i = 0; i < DISPLAY_QUEUE_DEPTH; i++) {
+    queueMessage("Message", String(i));
+  }
+  processDisplayQueue();
+  CHECK(!isShowingTime);
+  CHECK(litPixels(0, tft.height()) > 0);
+}
+
+int main() {
+  initSettings();
+  initDisplay();
+
+  testLargeSettingsWrapMessage();
+  testSmallSettingsUseSmallFont();
+  testSettingsChangeRelayoutsActiveScreen();
+  testStatusChangeRepaintsOnlyWidgets();
+  testLongTitleWraps();
+  testOverlongTitleShowsEllipsis();
+  testQueuedRequestsWaitForLoop();
+  testFullQueueKeepsNewest();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("display_test passed\n");
+  return 0;
+}
@@ -0,0 +1,161 @@
+// Host benchmark: characters per second for drawText() versus the old
+// setTextSize()/println() path.
+//
+// Both renderers draw into the counting Adafruit_SPITFT stub. Bus time is
+// derived from the bytes each one would clock out (address windows plus
+// pixel data), for two bus models:
+//  - software SPI as wired in display.h, where only the bit count matters
+//  - hardware SPI, where every address window also pays a fixed cost for the
+//    command/data switches and short transfers (BENCH_HW_WINDOW_US, an
+//    estimate, not a measurement)
+// Host CPU time is reported as well.
+//
+// drawText() is measured in both modes: opaque cells as the retained labels
+// use it, and transparent on a cleared area as showTemporaryMessage() and
+// showUrgentAlert() use it. The latter replaces the println path, so it must
+// be faster on the board's soft SPI at both text sizes.
+//
+// The legacy path is modelled on Adafruit_GFX::drawChar with a transparent
+// background (setTextColor(color) as display.cpp used it): every lit pixel of
+// the 5x7 cell becomes its own writePixel (size 1) or size x size
+// writeFillRect (size 2). glcdfont is not vendored here, so the lit pixels of
+// the 1bpp atlas glyphs (first 5 columns, first 8 rows) stand in for it.
+#include "font.h"
+#include "font_atlas.h"
+#include <chrono>
+
+unsigned long stubMillis = 0;
+
+#define BENCH_SOFT_SPI_HZ 4000000.0   // Bit-banged SPI on the pins in display.h
+#define BENCH_HW_SPI_HZ 27000000.0    // ESP32 hardware SPI
+#define BENCH_HW_WINDOW_US 3.0        // Per address window overhead on hardware SPI
+#define BENCH_REPEATS 2000
+
+// Text like the firmware shows; each fits on one line at text size 2, so no
+// renderer gets credit for clipped characters
+static const char* const sampleTexts[] = {
+  "Hello, World!",
+  "Device connected",
+  "Upcoming Meeting",
+  "Standup at 10:45",
+};
+
+static void legacyDrawChar(Adafruit_SPITFT& tft, int16_t x, int16_t y, char c, uint8_t size, uint16_t color) {
+  const FontAtlas& stand_in = font_small;
+  uint8_t code = (uint8_t)c;
+  if (code < stand_in.firstChar || code > stand_in.lastChar) code = '?';
+  const uint8_t* glyph = stand_in.bitmap + (code - stand_in.firstChar) * stand_in.height * stand_in.rowBytes;
+
+  tft.startWrite();
+  for (int8_t i = 0; i < 5; i++) {
+    for (int8_t j = 0; j < 8; j++) {
+      if (!(glyph[j * stand_in.rowBytes] & (0x80 >> i))) continue;
+      if (size == 1) {
+        tft.writePixel(x + i, y + j, color);
+      } else {
+        tft.writeFillRect(x + i * size, y + j * size, size, size, color);
+      }
+    }
+  }
+  tft.endWrite();
+}
+
+static void legacyPrintln(Adafruit_SPITFT& tft, int16_t x, int16_t y, const char* text, uint8_t size, uint16_t color) {
+  for (const char* p = text; *p; p++) {
+    legacyDrawChar(tft, x, y, *p, size, color);
+    x += 6 * size;
+  }
+}
+
+struct BenchResult {
+  double busBytesPerChar;
+  double windowsPerChar;
+  double softCharsPerSecond;
+  double hwCharsPerSecond;
+  double hostCharsPerSecond;
+};
+
+template <typename DrawLine>
+static BenchResult runBench(DrawLine drawLine) {
+  Adafruit_SPITFT tft;
+  size_t chars = 0;
+  for (const char* text : sampleTexts) chars += strlen(text) * BENCH_REPEATS;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    for (const char* text : sampleTexts) drawLine(tft, text);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  BenchResult r;
+  r.busBytesPerChar = (double)tft.busBytes() / chars;
+  r.windowsPerChar = (double)tft.windows / chars;
+  r.softCharsPerSecond = 1.0 / (r.busBytesPerChar * 8 / BENCH_SOFT_SPI_HZ);
+  r.hwCharsPerSecond = 1.0 / (r.busBytesPerChar * 8 / BENCH_HW_SPI_HZ + r.windowsPerChar * BENCH_HW_WINDOW_US * 1e-6);
+  r.hostCharsPerSecond = chars / seconds;
+  return r;
+}
+
+static void report(const char* name, const BenchResult& r) {
+  printf("  %-9s %7.1f bytes/char %5.2f windows/char | chars/s: soft SPI %7.0f  hw SPI %7.0f  host %9.0f\n",
+         name, r.busBytesPerChar, r.windowsPerChar, r.softCharsPerSecond, r.hwCharsPerSecond,
+         r.hostCharsPerSecond);
+}
+
+int main() {
+  int failures = 0;
+  printf("Text rendering of %zu sample lines\n", sizeof(sampleTexts) / sizeof(sampleTexts[0]));
+
+  for (uint8_t size = 1; size <= 2; size++) {
+    const FontAtlas& font = fontForTextSize(size);
+    BenchResult legacy = runBench([&](Adafruit_SPITFT& tft, const char* text) {
+      legacyPrintln(tft, 0, 0, text, size, 0xFFFF);
+    });
+    BenchResult opaque = runBench([&](Adafruit_SPITFT& tft, const char* text) {
+      drawText(tft, 0, 0, text, font, 0xFFFF, 0x0000);
+    });
+    BenchResult cleared = runBench([&](Adafruit_SPITFT& tft, const char* text) {
+      drawText(tft, 0, 0, text, font, 0xFFFF, 0x0000, false);
+    });
+
+    printf("text size %d (atlas cell %dx%d, %dbpp)\n", size, font.advance, font.height, font.bpp);
+    report("println", legacy);
+    report("opaque", opaque);
+    report("cleared", cleared);
+    printf("  drawText on cleared area vs println: soft SPI %.2fx, hw SPI %.2fx\n",
+           cleared.softCharsPerSecond / legacy.softCharsPerSecond,
+           cleared.hwCharsPerSecond / legacy.hwCharsPerSecond);
+
+    // Opaque drawText opens one address window per line, never one per glyph
+    if (opaque.windowsPerChar >= 1.0) {
+      printf("FAIL: opaque drawText used %.2f windows per char\n", opaque.windowsPerChar);
+      failures++;
+    }
+    // On a cleared area the transparent path must leave exactly the pixels
+    // the opaque one does
+    long mismatches = 0;
+    for (const char* text : sampleTexts) {
+      Adafruit_SPITFT expected, actual;
+      drawText(expected, 0, 0, text, font, 0xFFFF, 0x0000);
+      drawText(actual, 0, 0, text, font, 0xFFFF, 0x0000, false);
+      for (int16_t y = 0; y < font.height; y++) {
+        for (int16_t x = 0; x < expected.width(); x++) {
+          if (expected.pixelAt(x, y) != actual.pixelAt(x, y)) mismatches++;
+        }
+      }
+    }
+    if (mismatches) {
+      printf("FAIL: transparent drawText differs from opaque in %ld pixels\n", mismatches);
+      failures++;
+    }
+
+    // Messages are drawn onto a cleared screen; on the board's bit-banged SPI
+    // that has to be faster than the println path it replaced
+    if (cleared.softCharsPerSecond <= legacy.softCharsPerSecond) {
+      printf("FAIL: drawText %.0f chars/s on soft SPI, println %.0f\n",
+             cleared.softCharsPerSecond, legacy.softCharsPerSecond);
+      failures++;
+    }
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,6 @@
+#ifndef ADAFRUIT_GFX_H_STUB
+#define ADAFRUIT_GFX_H_STUB
+
+#include <Arduino.h>
+
+#endif
@@ -0,0 +1,81 @@
+// Host stand-in for Adafruit_SPITFT that keeps a framebuffer and counts what
+// would go over the SPI bus: one address window (CASET + RASET + RAMWR,
+// 11 bytes) per primitive, plus 2 bytes per pixel.
+#ifndef ADAFRUIT_SPITFT_H_STUB
+#define ADAFRUIT_SPITFT_H_STUB
+
+#include <Arduino.h>
+#include <vector>
+
+#define STUB_WINDOW_BYTES 11
+
+class Adafruit_SPITFT {
+public:
+  Adafruit_SPITFT(int16_t w = 160, int16_t h = 128) : w(w), h(h), framebuffer(w * h, 0) {}
+
+  int16_t width() const { return w; }
+  int16_t height() const { return h; }
+
+  void startWrite() {}
+  void endWrite() {}
+
+  void setAddrWindow(int16_t x, int16_t y, int16_t ww, int16_t wh) {
+    winX = x; winY = y; winW = ww; winH = wh; winPos = 0;
+    windows++;
+  }
+  void writePixels(uint16_t* colors, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) plot(colors[i]);
+    pixels += len;
+  }
+  void writePixel(int16_t x, int16_t y, uint16_t color) { fillRect(x, y, 1, 1, color); }
+  void writeFillRect(int16_t x, int16_t y, int16_t rw, int16_t rh, uint16_t color) { fillRect(x, y, rw, rh, color); }
+
+  void fillRect(int16_t x, int16_t y, int16_t rw, int16_t rh, uint16_t color) {
+    setAddrWindow(x, y, rw, rh);
+    for (int32_t i = 0; i < (int32_t)rw * rh; i++) plot(color);
+    pixels += (int32_t)rw * rh;
+  }
+  void fillScreen(uint16_t color) { fillRect(0, 0, w, h, color); }
+  void drawFastHLine(int16_t x, int16_t y, int16_t len, uint16_t color) { fillRect(x, y, len, 1, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t len, uint16_t color) { fillRect(x, y, 1, len, color); }
+  void drawRect(int16_t x, int16_t y, int16_t rw, int16_t rh, uint16_t color) {
+    drawFastHLine(x, y, rw, color);
+    drawFastHLine(x, y + rh - 1, rw, color);
+    drawFastVLine(x, y, rh, color);
+    drawFastVLine(x + rw - 1, y, rh, color);
+  }
+  // Like Adafruit_GFX, the opaque variant writes every pixel individually
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t bw, int16_t bh,
+                  uint16_t color, uint16_t bg) {
+    int16_t rowBytes = (bw + 7) / 8;
+    for (int16_t j = 0; j < bh; j++) {
+      for (int16_t i = 0; i < bw; i++) {
+        bool on = bitmap[j * rowBytes + i / 8] & (0x80 >> (i & 7));
+        writePixel(x + i, y + j, on ? color : bg);
+      }
+    }
+  }
+
+  uint16_t pixelAt(int16_t x, int16_t y) const { return framebuffer[y * w + x]; }
+  uint64_t busBytes() const { return windows * STUB_WINDOW_BYTES + pixels * 2; }
+  void resetCounters() { windows = 0; pixels = 0; }
+
+  uint64_t windows = 0;
+  uint64_t pixels = 0;
+
+private:
+  void plot(uint16_t color) {
+    if (winW <= 0) return;
+    int32_t px = winX + winPos % winW;
+    int32_t py = winY + winPos / winW;
+    winPos++;
+    if (px >= 0 && py >= 0 && px < w && py < h) framebuffer[py * w + px] = color;
+  }
+
+  int16_t w, h;
+  std::vector<uint16_t> framebuffer;
+  int16_t winX = 0, winY = 0, winW = 0, winH = 0;
+  int32_t winPos = 0;
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef ADAFRUIT_ST7735_H_STUB
+#define ADAFRUIT_ST7735_H_STUB
+
+#include <Adafruit_SPITFT.h>
+
+#define ST7735_BLACK 0x0000
+#define ST7735_WHITE 0xFFFF
+#define ST7735_RED 0xF800
+#define ST7735_BLUE 0x001F
+#define ST7735_CYAN 0x07FF
+#define ST7735_YELLOW 0xFFE0
+#define INITR_BLACKTAB 0
+
+// Landscape panel, as after setRotation(1)
+class Adafruit_ST7735 : public Adafruit_SPITFT {
+public:
+  Adafruit_ST7735(int8_t cs, int8_t dc, int8_t mosi, int8_t sclk, int8_t rst) : Adafruit_SPITFT(160, 128) {}
+  void initR(uint8_t options) {}
+  void setRotation(uint8_t rotation) {}
+};
+
+#endif
@@ -0,0 +1,51 @@
+// Host stand-in for the parts of the Arduino core the display and scheduler
+// code use, so they can be built with plain g++ for tests and benchmarks.
+#ifndef ARDUINO_H_STUB
+#define ARDUINO_H_STUB
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+class String {
+public:
+  String(const char* s = "") : s(s) {}
+  String(const std::string& s) : s(s) {}
+  String(int value) : s(std::to_string(value)) {}
+
+  unsigned int length() const { return s.size(); }
+  char charAt(unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  const char* c_str() const { return s.c_str(); }
+  String substring(unsigned int left) const { return substring(left, s.size()); }
+  String substring(unsigned int left, unsigned int right) const {
+    if (right > s.size()) right = s.size();
+    if (left > right) left = right;
+    return String(s.substr(left, right - left));
+  }
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator!=(const String& other) const { return s != other.s; }
+  String& operator+=(char c) { s += c; return *this; }
+  String& operator+=(const String& other) { s += other.s; return *this; }
+  String operator+(const String& other) const { return String(s + other.s); }
+
+private:
+  std::string s;
+};
+
+inline String operator+(const char* left, const String& right) { return String(left) + right; }
+
+// Simulated clock, advanced by the test
+extern unsigned long stubMillis;
+inline unsigned long millis() { return stubMillis; }
+inline void delay(unsigned long ms) { stubMillis += ms; }
+
+// FreeRTOS spinlocks are no-ops on a single host thread
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#endif
@@ -0,0 +1,3 @@
+#ifndef ARDUINOJSON_H_STUB
+#define ARDUINOJSON_H_STUB
+#endif
@@ -0,0 +1,3 @@
+#ifndef SPI_H_STUB
+#define SPI_H_STUB
+#endif
@@ -0,0 +1,129 @@
+// Host test: pixels repainted by the retained clock screen.
+//
+// Runs the real clock screen from display.cpp through showTimeDisplay() and
+// updateTimeDisplay(), with the simulated clock set to the wanted time, over
+// a day of 5 second ticks, and checks that a minute change repaints only the
+// digit cells that changed.
+#include "display.h"
+#include <vector>
+
+unsigned long stubMillis = 0;
+extern Adafruit_ST7735 tft;
+
+static int failures = 0;
+
+#define CHECK_EQ(actual, expected)                                              \
+  do {                                                                          \
+    long long a = (actual), e = (expected);                                     \
+    if (a != e) {                                                               \
+      printf("FAIL %s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__,     \
+             #actual, a, e);                                                    \
+      failures++;                                                               \
+    }                                                                           \
+  } while (0)
+
+// Move the simulated clock to hour:minute of the first day since startTime
+static void setClock(int hour, int minute) {
+  stubMillis = startTime + (hour * 60UL + minute) * 60000UL;
+}
+
+// Clock screen freshly shown at hour:minute
+static void showClockAt(int hour, int minute) {
+  clearDisplay();
+  setClock(hour, minute);
+  showTimeDisplay();
+}
+
+// Repainted pixels for a single change of the clock from one time to another
+static uint64_t repaintFor(int fromHour, int fromMinute, int toHour, int toMinute, uint64_t* windows = nullptr) {
+  showClockAt(fromHour, fromMinute);
+  tft.resetCounters();
+  setClock(toHour, toMinute);
+  updateTimeDisplay();
+  if (windows) *windows = tft.windows;
+  return tft.pixels;
+}
+
+static std::vector<uint16_t> snapshot() {
+  std::vector<uint16_t> pixels;
+  for (int16_t y = 0; y < tft.height(); y++) {
+    for (int16_t x = 0; x < tft.width(); x++) {
+      pixels.push_back(tft.pixelAt(x, y));
+    }
+  }
+  return pixels;
+}
+
+static void testSingleDigitTick() {
+  const FontAtlas& large = fontForTextSize(2);
+  uint64_t windows = 0;
+  CHECK_EQ(repaintFor(12, 34, 12, 35, &windows), large.advance * large.height);
+  CHECK_EQ(windows, 1);
+}
+
+static void testHourRollover() {
+  const FontAtlas& large = fontForTextSize(2);
+  // 12:59 -> 13:00 changes the hour's last digit and both minute digits
+  CHECK_EQ(repaintFor(12, 59, 13, 0), 3 * large.advance * large.height);
+}
+
+static void testUnchangedTickPaintsNothing() {
+  CHECK_EQ(repaintFor(8, 15, 8, 15), 0);
+}
+
+// The incrementally updated screen must match one drawn from scratch
+static void testIncrementalMatchesFullRedraw() {
+  showClockAt(10, 0);
+  std::vector<uint16_t> expected = snapshot();
+
+  showClockAt(9, 59);
+  setClock(10, 0);
+  updateTimeDisplay();
+  std::vector<uint16_t> incremental = snapshot();
+
+  long mismatches = 0;
+  for (size_t i = 0; i < expected.size(); i++) {
+    if (incremental[i] != expected[i]) mismatches++;
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+// A day of loop() ticks: updateTimeDisplay() runs every 5 s
+static void reportPixelsPerMinute() {
+  showClockAt(0, 0);
+  tft.resetCounters();
+
+  const int minutes = 24 * 60;
+  for (int m = 1; m <= minutes; m++) {
+    // The minute changes on the first of the 12 ticks, the other 11 are no-ops
+    for (int tick = 0; tick < 12; tick++) {
+      setClock(0, m);
+      stubMillis += tick * 5000UL;
+      updateTimeDisplay();
+    }
+  }
+
+  double perMinute = (double)tft.pixels / minutes;
+  double fullRedraw = 12.0 * tft.width() * tft.height();
+  printf("clock screen: %.1f repainted pixels/minute (full redraw every 5 s: %.0f)\n",
+         perMinute, fullRedraw);
+  CHECK_EQ(perMinute < fullRedraw / 100, true);
+}
+
+int main() {
+  initSettings();
+  initDisplay();
+
+  testSingleDigitTick();
+  testHourRollover();
+  testUnchangedTickPaintsNothing();
+  testIncrementalMatchesFullRedraw();
+  reportPixelsPerMinute();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("widgets_test passed\n");
+  return 0;
+}
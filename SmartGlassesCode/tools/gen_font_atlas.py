@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Rasterize a monospaced TTF into constexpr glyph atlases for font.cpp.
+
+Every glyph is stored as a fixed advance x height cell, row by row, so the
+renderer can stream whole glyph rows to the display without per-pixel calls.
+Each font size is emitted twice: a 1bpp variant and a 4bpp anti-aliased one.
+
+Usage:
+  pip install pillow
+  python3 tools/gen_font_atlas.py > font_atlas.h
+"""
+
+import argparse
+import os
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+DEFAULT_FONT = "/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf"
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+# (atlas name, pixel size) - "small" backs text size 1, "large" text size 2
+SIZES = [("small", 10), ("large", 16)]
+
+
+def render_cells(font_path, pixel_size):
+    """Return (advance, height, mono_cells, aa_cells) sharing one crop box."""
+    font = ImageFont.truetype(font_path, pixel_size)
+    advance = int(round(font.getlength("M")))
+    ascent, descent = font.getmetrics()
+    canvas_h = ascent + descent
+
+    variants = {"1": [], "L": []}
+    top, bottom = canvas_h, 0
+    for mode, cells in variants.items():
+        for code in range(FIRST_CHAR, LAST_CHAR + 1):
+            img = Image.new("L", (advance, canvas_h), 0)
+            draw = ImageDraw.Draw(img)
+            # fontmode "1" uses the hinted monochrome rasterizer, which keeps
+            # thin strokes instead of thresholding them away
+            draw.fontmode = mode
+            draw.text((0, 0), chr(code), font=font, fill=255)
+            bbox = img.getbbox()
+            if bbox:
+                top = min(top, bbox[1])
+                bottom = max(bottom, bbox[3])
+            cells.append(img)
+
+    # Crop the rows that are blank for every glyph so line height stays tight
+    crop = lambda img: img.crop((0, top, advance, bottom))
+    return (advance, bottom - top,
+            [crop(img) for img in variants["1"]],
+            [crop(img) for img in variants["L"]])
+
+
+def pack_cell(img, bpp):
+    width, height = img.size
+    px = img.load()
+    out = []
+    for y in range(height):
+        if bpp == 1:
+            for x0 in range(0, width, 8):
+                byte = 0
+                for bit in range(8):
+                    x = x0 + bit
+                    if x < width and px[x, y] >= 128:
+                        byte |= 0x80 >> bit
+                out.append(byte)
+        else:
+            for x0 in range(0, width, 2):
+                hi = px[x0, y] >> 4
+                lo = px[x0 + 1, y] >> 4 if x0 + 1 < width else 0
+                out.append((hi << 4) | lo)
+    return out
+
+
+def emit_atlas(lines, name, advance, height, cells, bpp):
+    row_bytes = (advance + 7) // 8 if bpp == 1 else (advance + 1) // 2
+    ident = "font_%s%s" % (name, "_aa" if bpp == 4 else "")
+
+    lines.append("// %dx%d cells, %dbpp, %d bytes per row" % (advance, height, bpp, row_bytes))
+    lines.append("static constexpr uint8_t %s_bitmap[] = {" % ident)
+    for code, img in zip(range(FIRST_CHAR, LAST_CHAR + 1), cells):
+        data = ", ".join("0x%02X" % b for b in pack_cell(img, bpp))
+        label = chr(code) if code != 0x5C else "backslash"
+        lines.append("  %s,  // '%s'" % (data, label))
+    lines.append("};")
+    lines.append("")
+    lines.append("static constexpr FontAtlas %s = {" % ident)
+    lines.append("  0x%02X, 0x%02X, %d, %d, %d, %d, %s_bitmap" % (
+        FIRST_CHAR, LAST_CHAR, advance, height, bpp, row_bytes, ident))
+    lines.append("};")
+    lines.append("")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--font", default=DEFAULT_FONT, help="monospaced TTF to rasterize")
+    args = parser.parse_args()
+
+    lines = [
+        "// Generated by tools/gen_font_atlas.py from %s - do not edit by hand." % os.path.basename(args.font),
+        "#ifndef FONT_ATLAS_H",
+        "#define FONT_ATLAS_H",
+        "",
+        '#include "font.h"',
+        "",
+    ]
+    for name, pixel_size in SIZES:
+        advance, height, mono_cells, aa_cells = render_cells(args.font, pixel_size)
+        emit_atlas(lines, name, advance, height, mono_cells, 1)
+        emit_atlas(lines, name, advance, height, aa_cells, 4)
+    lines.append("#endif")
+
+    sys.stdout.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
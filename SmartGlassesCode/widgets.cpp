@@ -0,0 +1,121 @@
+#include "widgets.h"
+
+void Widget::setBounds(int16_t newX, int16_t newY, int16_t newW, int16_t newH) {
+  x = newX;
+  y = newY;
+  w = newW;
+  h = newH;
+  invalidate();
+}
+
+void Widget::render(Adafruit_SPITFT& tft) {
+  if (!dirty) return;
+  paint(tft, fullRepaint);
+  dirty = false;
+  fullRepaint = false;
+}
+
+// Character at a cell, with cells past the end of the string reading as blank
+static char cellAt(const String& s, unsigned int i) {
+  return (i < s.length()) ? s.charAt(i) : ' ';
+}
+
+void LabelWidget::setText(const String& newText) {
+  if (newText == text) return;
+  text = newText;
+  markDirty();
+}
+
+void LabelWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void LabelWidget::setTextSize(uint8_t newTextSize) {
+  if (newTextSize == textSize) return;
+  textSize = newTextSize;
+  invalidate();
+}
+
+void LabelWidget::paint(Adafruit_SPITFT& tft, bool full) {
+  const FontAtlas& font = fontForTextSize(textSize);
+  String shown = text.substring(0, w / font.advance);
+
+  if (full) {
+    int16_t end = drawText(tft, x, y, shown, font, color, background);
+    if (end < x + w) {
+      tft.fillRect(end, y, x + w - end, font.height, background);
+    }
+    painted = shown;
+    return;
+  }
+
+  // Redraw each run of cells that differs from what is on screen
+  unsigned int cells = (shown.length() > painted.length()) ? shown.length() : painted.length();
+  int runStart = -1;
+  for (unsigned int i = 0; i <= cells; i++) {
+    bool changed = (i < cells) && cellAt(shown, i) != cellAt(painted, i);
+    if (changed && runStart < 0) {
+      runStart = i;
+    } else if (!changed && runStart >= 0) {
+      String run;
+      for (unsigned int k = runStart; k < i; k++) {
+        run += cellAt(shown, k);
+      }
+      drawText(tft, x + runStart * font.advance, y, run, font, color, background);
+      runStart = -1;
+    }
+  }
+  painted = shown;
+}
+
+void ClockWidget::setTime(int hour, int minute) {
+  char buf[6];
+  snprintf(buf, sizeof(buf), "%02d:%02d", hour, minute);
+  setText(buf);
+}
+
+void DividerWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void DividerWidget::paint(Adafruit_SPITFT& tft, bool full) {
+  tft.drawFastHLine(x, y, w, color);
+}
+
+void BorderWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void BorderWidget::paint(Adafruit_SPITFT& tft, bool full) {
+  for (int j = 0; j < thickness; j++) {
+    tft.drawRect(x + j, y + j, w - j * 2, h - j * 2, color);
+  }
+}
+
+void IconWidget::setColor(uint16_t newColor) {
+  if (newColor == color) return;
+  color = newColor;
+  invalidate();
+}
+
+void IconWidget::paint(Adafruit_SPITFT& tft, bool full) {
+  tft.drawBitmap(x, y, bitmap, w, h, color, background);
+}
+
+void Screen::invalidate() {
+  for (uint8_t i = 0; i < count; i++) {
+    widgets[i]->invalidate();
+  }
+}
+
+void Screen::render(Adafruit_SPITFT& tft) {
+  for (uint8_t i = 0; i < count; i++) {
+    widgets[i]->render(tft);
+  }
+}
@@ -0,0 +1,115 @@
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include <Adafruit_SPITFT.h>
+#include <Arduino.h>
+#include "font.h"
+
+// Retained-mode UI: widgets keep their own state and only repaint when they
+// have been invalidated. A Screen owns a fixed list of widgets and renders
+// the dirty ones, so an update touches only the pixels that changed.
+
+class Widget {
+public:
+  Widget(uint16_t background) : background(background) {}
+  virtual ~Widget() {}
+
+  void setBounds(int16_t x, int16_t y, int16_t w, int16_t h);
+  // Force a full repaint on the next render (e.g. after the screen was cleared)
+  void invalidate() { dirty = true; fullRepaint = true; }
+  bool isDirty() const { return dirty; }
+  void render(Adafruit_SPITFT& tft);
+
+protected:
+  // full = false means only the state changed since the last paint needs drawing
+  virtual void paint(Adafruit_SPITFT& tft, bool full) = 0;
+  void markDirty() { dirty = true; }
+
+  int16_t x = 0, y = 0, w = 0, h = 0;
+  uint16_t background;
+
+private:
+  bool dirty = true;
+  bool fullRepaint = true;
+};
+
+// Single line of text. Repaints are diffed per character cell, so changing
+// "12:34" to "12:35" only redraws the last glyph.
+class LabelWidget : public Widget {
+public:
+  LabelWidget(uint8_t textSize, uint16_t color, uint16_t background)
+    : Widget(background), textSize(textSize), color(color) {}
+
+  void setText(const String& newText);
+  void setColor(uint16_t newColor);
+  void setTextSize(uint8_t newTextSize);
+
+protected:
+  void paint(Adafruit_SPITFT& tft, bool full) override;
+
+  uint8_t textSize;
+  uint16_t color;
+  String text;
+  String painted;
+};
+
+// HH:MM clock, a label whose text is driven by setTime()
+class ClockWidget : public LabelWidget {
+public:
+  ClockWidget(uint8_t textSize, uint16_t color, uint16_t background)
+    : LabelWidget(textSize, color, background) {}
+
+  void setTime(int hour, int minute);
+};
+
+// Horizontal rule spanning the widget width
+class DividerWidget : public Widget {
+public:
+  DividerWidget(uint16_t color, uint16_t background) : Widget(background), color(color) {}
+  void setColor(uint16_t newColor);
+
+protected:
+  void paint(Adafruit_SPITFT& tft, bool full) override;
+  uint16_t color;
+};
+
+// Rectangular frame of the given thickness drawn inside the widget bounds
+class BorderWidget : public Widget {
+public:
+  BorderWidget(uint8_t thickness, uint16_t color, uint16_t background)
+    : Widget(background), thickness(thickness), color(color) {}
+  void setColor(uint16_t newColor);
+
+protected:
+  void paint(Adafruit_SPITFT& tft, bool full) override;
+  uint8_t thickness;
+  uint16_t color;
+};
+
+// 1bpp bitmap in Adafruit_GFX drawBitmap format (MSB first, rows byte padded)
+class IconWidget : public Widget {
+public:
+  IconWidget(const uint8_t* bitmap, uint16_t color, uint16_t background)
+    : Widget(background), bitmap(bitmap), color(color) {}
+  void setColor(uint16_t newColor);
+
+protected:
+  void paint(Adafruit_SPITFT& tft, bool full) override;
+  const uint8_t* bitmap;
+  uint16_t color;
+};
+
+class Screen {
+public:
+  Screen(Widget* const* widgets, uint8_t count) : widgets(widgets), count(count) {}
+
+  void invalidate();
+  // Paint only the widgets that changed since the last render
+  void render(Adafruit_SPITFT& tft);
+
+private:
+  Widget* const* widgets;
+  uint8_t count;
+};
+
+#endif